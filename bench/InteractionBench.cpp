@@ -0,0 +1,317 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Scripted interactions on a canvas of 10, 100 and 500 synthetic widget
+// cards: full repaint, dragging and resizing a card, the position clamp on
+// window resize, restoring a layout through RestorePipeline, and opening the
+// Add Widget dialog with as many plugins. A step includes the repaint it
+// causes. The p50/p95/p99 step time and the heap allocations per step are
+// printed, and p50 is reported as the benchmark result.
+//
+//   QT_QPA_PLATFORM=offscreen ./interaction-bench
+//   QT_QPA_PLATFORM=offscreen ./interaction-bench dragFrame:500
+
+#include "AllocationCounter.h"
+#include "SyntheticWidget.h"
+#include "core/PluginLoader.h"
+#include "core/WidgetManager.h"
+#include "ui/AddWidgetDialog.h"
+#include "ui/PreviewCache.h"
+#include "ui/RestorePipeline.h"
+#include "ui/Theme.h"
+#include "ui/WidgetCanvas.h"
+#include "ui/WidgetFrame.h"
+
+#include <QApplication>
+#include <QElapsedTimer>
+#include <QMouseEvent>
+#include <QtTest>
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+using namespace dashboard;
+
+static constexpr int kSteps = 120;
+static constexpr int kStepPixels = 4;
+static constexpr int kRestoreRuns = 5;
+static constexpr int kDialogRuns = 10;
+static constexpr QSize kCanvasSize(1920, 1080);
+static constexpr QSize kSmallCanvasSize(1280, 720);
+static constexpr QPoint kGrabPoint(20, 20);  // inside the card, clear of its resize edges
+
+namespace {
+
+// Step times and allocation counts of one benchmark row
+class StepRecorder {
+public:
+    void begin() {
+        allocationsAtBegin_ = bench::allocationCount();
+        timer_.start();
+    }
+
+    void end() {
+        samplesNs_.push_back(timer_.nsecsElapsed());
+        allocations_ += bench::allocationCount() - allocationsAtBegin_;
+    }
+
+    void report() {
+        std::sort(samplesNs_.begin(), samplesNs_.end());
+        auto percentileMs = [this](double p) {
+            size_t i = std::min(samplesNs_.size() - 1, size_t(p * samplesNs_.size()));
+            return samplesNs_[i] / 1e6;
+        };
+        qInfo().noquote() << QString("%1:%2  p50 %3 ms  p95 %4 ms  p99 %5 ms  %6 allocations/step")
+                                 .arg(QTest::currentTestFunction(), QTest::currentDataTag())
+                                 .arg(percentileMs(0.50), 0, 'f', 3)
+                                 .arg(percentileMs(0.95), 0, 'f', 3)
+                                 .arg(percentileMs(0.99), 0, 'f', 3)
+                                 .arg(allocations_ / samplesNs_.size());
+        QTest::setBenchmarkResult(percentileMs(0.50), QTest::WalltimeMilliseconds);
+    }
+
+private:
+    QElapsedTimer timer_;
+    std::vector<qint64> samplesNs_;
+    std::uint64_t allocationsAtBegin_ = 0;
+    std::uint64_t allocations_ = 0;
+};
+
+// Delivers pending resizes, then the repaint they caused
+void flush() {
+    QCoreApplication::processEvents();
+    QCoreApplication::sendPostedEvents();
+}
+
+void sendMouse(QWidget* target, QEvent::Type type, const QPoint& pos) {
+    const Qt::MouseButton button = type == QEvent::MouseMove ? Qt::NoButton : Qt::LeftButton;
+    const Qt::MouseButtons buttons = type == QEvent::MouseButtonRelease ? Qt::NoButton
+                                                                        : Qt::LeftButton;
+    QMouseEvent event(type, pos, target->mapToGlobal(pos), button, buttons, Qt::NoModifier);
+    QCoreApplication::sendEvent(target, &event);
+}
+
+// Moves back and forth so the card stays on the canvas
+int oscillation(int step) {
+    const int phase = step % 30;
+    return kStepPixels * (phase < 15 ? phase : 30 - phase);
+}
+
+QPoint cardPosition(int i) {
+    return {(i * 37) % (kCanvasSize.width() - 220), (i * 23) % (kCanvasSize.height() - 140)};
+}
+
+}  // namespace
+
+class InteractionBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void initTestCase();
+
+    void repaintCanvas_data();
+    void repaintCanvas();
+    void dragFrame_data();
+    void dragFrame();
+    void resizeFrame_data();
+    void resizeFrame();
+    void clampOnResize_data();
+    void clampOnResize();
+    void restoreLayout_data();
+    void restoreLayout();
+    void openAddWidgetDialog_data();
+    void openAddWidgetDialog();
+
+private:
+    static void addCardCounts();
+    std::unique_ptr<WidgetCanvas> buildCanvas(int cards);
+    SyntheticWidget* plugin(int i) const;
+
+    PluginLoader pluginLoader_;
+    WidgetManager widgetManager_{pluginLoader_};
+    std::vector<std::unique_ptr<SyntheticWidget>> plugins_;
+};
+
+void InteractionBench::initTestCase() {
+    Theme::apply(*qApp, Theme::dark());
+    for (int kind = 0; kind < SyntheticWidget::kKindCount; ++kind) {
+        plugins_.push_back(std::make_unique<SyntheticWidget>(
+            SyntheticWidget::Kind(kind), QString("Synthetic %1").arg(kind)));
+        widgetManager_.addBuiltin(plugins_.back().get());
+    }
+}
+
+void InteractionBench::addCardCounts() {
+    QTest::addColumn<int>("cards");
+    QTest::newRow("10") << 10;
+    QTest::newRow("100") << 100;
+    QTest::newRow("500") << 500;
+}
+
+SyntheticWidget* InteractionBench::plugin(int i) const {
+    return plugins_[i % plugins_.size()].get();
+}
+
+std::unique_ptr<WidgetCanvas> InteractionBench::buildCanvas(int cards) {
+    auto canvas = std::make_unique<WidgetCanvas>();
+    canvas->resize(kCanvasSize);
+    for (int i = 0; i < cards; ++i) {
+        canvas->addWidget(plugin(i), cardPosition(i));
+    }
+    canvas->show();
+    flush();
+    return canvas;
+}
+
+void InteractionBench::repaintCanvas_data() {
+    addCardCounts();
+}
+
+void InteractionBench::repaintCanvas() {
+    QFETCH(int, cards);
+    auto canvas = buildCanvas(cards);
+    StepRecorder recorder;
+    for (int step = 0; step < kSteps; ++step) {
+        recorder.begin();
+        canvas->repaint();
+        recorder.end();
+    }
+    recorder.report();
+}
+
+void InteractionBench::dragFrame_data() {
+    addCardCounts();
+}
+
+void InteractionBench::dragFrame() {
+    QFETCH(int, cards);
+    auto canvas = buildCanvas(cards);
+    WidgetFrame* frame = canvas->frames().at(cards / 2);
+
+    // The card moves with the pointer, so each move is one step from the grab point
+    StepRecorder recorder;
+    sendMouse(frame, QEvent::MouseButtonPress, kGrabPoint);
+    for (int step = 0; step < kSteps; ++step) {
+        const int dx = step % 30 < 15 ? kStepPixels : -kStepPixels;
+        recorder.begin();
+        sendMouse(frame, QEvent::MouseMove, kGrabPoint + QPoint(dx, dx / 2));
+        flush();
+        recorder.end();
+    }
+    sendMouse(frame, QEvent::MouseButtonRelease, kGrabPoint);
+    recorder.report();
+}
+
+void InteractionBench::resizeFrame_data() {
+    addCardCounts();
+}
+
+void InteractionBench::resizeFrame() {
+    QFETCH(int, cards);
+    auto canvas = buildCanvas(cards);
+    WidgetFrame* frame = canvas->frames().at(cards / 2);
+
+    // Bottom-right corner: the card's origin stays put while it grows and shrinks
+    const QPoint corner(frame->width() - 2, frame->height() - 2);
+    StepRecorder recorder;
+    sendMouse(frame, QEvent::MouseButtonPress, corner);
+    for (int step = 0; step < kSteps; ++step) {
+        const int offset = oscillation(step);
+        recorder.begin();
+        sendMouse(frame, QEvent::MouseMove, corner + QPoint(offset, offset));
+        flush();
+        recorder.end();
+    }
+    sendMouse(frame, QEvent::MouseButtonRelease, corner);
+    recorder.report();
+}
+
+void InteractionBench::clampOnResize_data() {
+    addCardCounts();
+}
+
+void InteractionBench::clampOnResize() {
+    QFETCH(int, cards);
+    auto canvas = buildCanvas(cards);
+    StepRecorder recorder;
+    for (int step = 0; step < kSteps; ++step) {
+        recorder.begin();
+        canvas->resize(step % 2 == 0 ? kSmallCanvasSize : kCanvasSize);
+        flush();
+        recorder.end();
+    }
+    recorder.report();
+}
+
+void InteractionBench::restoreLayout_data() {
+    addCardCounts();
+}
+
+void InteractionBench::restoreLayout() {
+    QFETCH(int, cards);
+    StepRecorder recorder;
+    for (int run = 0; run < kRestoreRuns; ++run) {
+        auto canvas = buildCanvas(0);
+        QList<WidgetFrame*> placeholders;
+        for (int i = 0; i < cards; ++i) {
+            const auto meta = plugin(i)->metadata();
+            placeholders.append(
+                canvas->addPlaceholder(meta.name, QRect(cardPosition(i), meta.defaultSize)));
+        }
+        flush();
+
+        RestorePipeline pipeline(*canvas, widgetManager_);
+        QSignalSpy finished(&pipeline, &RestorePipeline::finished);
+        recorder.begin();
+        pipeline.start(placeholders);
+        QVERIFY(finished.wait(30000));
+        flush();
+        recorder.end();
+    }
+    recorder.report();
+}
+
+void InteractionBench::openAddWidgetDialog_data() {
+    addCardCounts();
+}
+
+void InteractionBench::openAddWidgetDialog() {
+    QFETCH(int, cards);
+    // One plugin per card here: the dialog lists plugins, not cards
+    PluginLoader pluginLoader;
+    WidgetManager widgetManager(pluginLoader);
+    std::vector<std::unique_ptr<SyntheticWidget>> plugins;
+    for (int i = 0; i < cards; ++i) {
+        plugins.push_back(std::make_unique<SyntheticWidget>(
+            SyntheticWidget::Kind(i % SyntheticWidget::kKindCount), QString("Synthetic %1").arg(i)));
+        widgetManager.addBuiltin(plugins.back().get());
+    }
+    PreviewCache previews;
+
+    StepRecorder recorder;
+    for (int run = 0; run < kDialogRuns; ++run) {
+        recorder.begin();
+        {
+            AddWidgetDialog dialog(widgetManager, previews);
+            dialog.show();
+            flush();
+        }
+        recorder.end();
+    }
+    recorder.report();
+}
+
+QTEST_MAIN(InteractionBench)
+#include "InteractionBench.moc"
@@ -0,0 +1,109 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "SyntheticWidget.h"
+
+#include <QLabel>
+#include <QListWidget>
+#include <QPainter>
+#include <QPainterPath>
+#include <QVBoxLayout>
+#include <cmath>
+
+namespace dashboard {
+
+static constexpr int kChartPoints = 64;
+static constexpr int kLabelRows = 4;
+static constexpr int kListItems = 20;
+
+namespace {
+
+// Gradient, grid and a line chart: roughly what a sparkline widget paints
+class ChartContent : public QWidget {
+public:
+    using QWidget::QWidget;
+
+protected:
+    void paintEvent(QPaintEvent*) override {
+        QPainter painter(this);
+        painter.setRenderHint(QPainter::Antialiasing);
+        QLinearGradient gradient(0, 0, 0, height());
+        gradient.setColorAt(0, QColor(0x30, 0x30, 0x48));
+        gradient.setColorAt(1, QColor(0x1e, 0x1e, 0x2e));
+        painter.fillRect(rect(), gradient);
+
+        painter.setPen(QColor(0x3e, 0x3e, 0x60));
+        for (int y = height() / 4; y < height(); y += height() / 4 + 1) {
+            painter.drawLine(0, y, width(), y);
+        }
+
+        QPainterPath path;
+        for (int i = 0; i < kChartPoints; ++i) {
+            const double x = width() * i / double(kChartPoints - 1);
+            const double y = height() * (0.5 + 0.35 * std::sin(i * 0.3));
+            i == 0 ? path.moveTo(x, y) : path.lineTo(x, y);
+        }
+        painter.setPen(QPen(QColor(0x7a, 0xa2, 0xf7), 2));
+        painter.drawPath(path);
+        painter.drawText(rect().adjusted(8, 4, -8, -4), Qt::AlignTop | Qt::AlignLeft, "42.0 %");
+    }
+};
+
+}  // namespace
+
+SyntheticWidget::SyntheticWidget(Kind kind, const QString& name) : kind_(kind), name_(name) {}
+
+SyntheticWidget::Metadata SyntheticWidget::metadata() const {
+    Metadata meta{};
+    meta.name = name_;
+    meta.description = QString("Synthetic benchmark widget (%1)").arg(int(kind_));
+    meta.defaultSize = QSize(200, 120);
+    meta.minSize = QSize(120, 80);
+    meta.maxSize = QSize(800, 600);
+    return meta;
+}
+
+QWidget* SyntheticWidget::createWidget(QWidget* parent) {
+    switch (kind_) {
+        case Kind::Chart:
+            return new ChartContent(parent);
+        case Kind::Labels: {
+            auto* content = new QWidget(parent);
+            auto* layout = new QVBoxLayout(content);
+            for (int i = 0; i < kLabelRows; ++i) {
+                layout->addWidget(new QLabel(QString("Row %1: %2").arg(i).arg(i * 17), content));
+            }
+            return content;
+        }
+        case Kind::List: {
+            auto* list = new QListWidget(parent);
+            for (int i = 0; i < kListItems; ++i) {
+                list->addItem(QString("Item %1").arg(i));
+            }
+            return list;
+        }
+    }
+    return nullptr;
+}
+
+QJsonObject SyntheticWidget::serialize() const {
+    return data_;
+}
+
+void SyntheticWidget::deserialize(const QJsonObject& data) {
+    data_ = data;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,54 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <dashboard/IWidget.h>
+
+#include <QJsonObject>
+#include <QString>
+#include <type_traits>
+#include <utility>
+
+class QWidget;
+
+namespace dashboard {
+
+// Stand-in widget plugins for the benchmarks, compiled into the benchmark
+// and registered with WidgetManager::addBuiltin instead of loaded from a
+// library. The kinds cover the usual content: painted, layout of labels,
+// and an item view.
+class SyntheticWidget : public IWidget {
+public:
+    enum class Kind { Chart, Labels, List };
+    static constexpr int kKindCount = 3;
+
+    // Whatever metadata() of the SDK returns
+    using Metadata = std::remove_cvref_t<decltype(std::declval<const IWidget&>().metadata())>;
+
+    SyntheticWidget(Kind kind, const QString& name);
+
+    Metadata metadata() const override;
+    QWidget* createWidget(QWidget* parent) override;
+    QJsonObject serialize() const override;
+    void deserialize(const QJsonObject& data) override;
+
+private:
+    Kind kind_;
+    QString name_;
+    QJsonObject data_;
+};
+
+}  // namespace dashboard
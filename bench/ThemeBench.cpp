@@ -0,0 +1,141 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+// Widget creation and repaint cost of 100 widget cards, comparing the chrome
+// the dashboard shipped before the compiled theme (LegacyFrame below: style
+// sheets on the card and its delete button, resources/theme.qss on the
+// application) against WidgetFrame with ThemeStyle. Both cards carry the same
+// drop shadow and content.
+//
+//   QT_QPA_PLATFORM=offscreen ./theme-bench
+
+#include "ui/Theme.h"
+#include "ui/WidgetFrame.h"
+
+#include <QApplication>
+#include <QFile>
+#include <QFrame>
+#include <QGraphicsDropShadowEffect>
+#include <QLabel>
+#include <QPushButton>
+#include <QStyleFactory>
+#include <QVBoxLayout>
+#include <QtTest>
+#include <memory>
+
+using namespace dashboard;
+
+static constexpr int kFrameCount = 100;
+
+// The card as WidgetFrame built it before the compiled theme
+class LegacyFrame : public QFrame {
+public:
+    LegacyFrame(QWidget* content, QWidget* parent) : QFrame(parent) {
+        setFrameShape(QFrame::NoFrame);
+        setAttribute(Qt::WA_StyledBackground, true);
+        setObjectName("widgetFrame");
+        setStyleSheet(
+            "#widgetFrame { background-color: #26263a; border: 1px solid #3e3e60;"
+            " border-radius: 10px; }");
+
+        auto* shadow = new QGraphicsDropShadowEffect(this);
+        shadow->setBlurRadius(18);
+        shadow->setOffset(0, 4);
+        shadow->setColor(QColor(0, 0, 0, 140));
+        setGraphicsEffect(shadow);
+
+        auto* layout = new QVBoxLayout(this);
+        layout->setContentsMargins(8, 8, 8, 8);
+        layout->addWidget(content);
+
+        auto* deleteButton = new QPushButton("✕", this);
+        deleteButton->setFixedSize(22, 22);
+        deleteButton->setStyleSheet(
+            "QPushButton { background-color: #36364e; color: #a0a8c8; border: none; "
+            "border-radius: 11px; font-size: 12px; font-weight: bold; }"
+            "QPushButton:hover { background-color: #d04040; color: white; }");
+        deleteButton->hide();
+    }
+};
+
+class ThemeBench : public QObject {
+    Q_OBJECT
+
+private slots:
+    void createFrames_data();
+    void createFrames();
+    void repaintFrames_data();
+    void repaintFrames();
+
+private:
+    void useLegacyTheme(bool legacy);
+    std::unique_ptr<QWidget> buildCanvas(bool legacy);
+};
+
+void ThemeBench::useLegacyTheme(bool legacy) {
+    if (legacy) {
+        QFile sheet(LEGACY_THEME_QSS);
+        sheet.open(QIODevice::ReadOnly);
+        qApp->setStyle(QStyleFactory::create("Fusion"));
+        qApp->setStyleSheet(QString::fromUtf8(sheet.readAll()));
+        return;
+    }
+    qApp->setStyleSheet(QString());
+    Theme::apply(*qApp, Theme::dark());
+}
+
+std::unique_ptr<QWidget> ThemeBench::buildCanvas(bool legacy) {
+    auto canvas = std::make_unique<QWidget>();
+    canvas->resize(2200, 1200);
+    for (int i = 0; i < kFrameCount; ++i) {
+        auto* content = new QLabel(QString("Widget %1").arg(i));
+        QWidget* frame = legacy ? static_cast<QWidget*>(new LegacyFrame(content, canvas.get()))
+                                : new WidgetFrame(content, canvas.get());
+        frame->setGeometry((i % 10) * 215 + 10, (i / 10) * 115 + 10, 200, 100);
+    }
+    canvas->show();
+    QCoreApplication::processEvents();
+    return canvas;
+}
+
+void ThemeBench::createFrames_data() {
+    QTest::addColumn<bool>("legacy");
+    QTest::newRow("style sheets (before)") << true;
+    QTest::newRow("compiled theme") << false;
+}
+
+void ThemeBench::createFrames() {
+    QFETCH(bool, legacy);
+    useLegacyTheme(legacy);
+    QBENCHMARK {
+        auto canvas = buildCanvas(legacy);
+    }
+}
+
+void ThemeBench::repaintFrames_data() {
+    createFrames_data();
+}
+
+void ThemeBench::repaintFrames() {
+    QFETCH(bool, legacy);
+    useLegacyTheme(legacy);
+    auto canvas = buildCanvas(legacy);
+    QBENCHMARK {
+        canvas->repaint();
+    }
+}
+
+QTEST_MAIN(ThemeBench)
+#include "ThemeBench.moc"
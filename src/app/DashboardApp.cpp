@@ -15,40 +15,237 @@
 
 #include "DashboardApp.h"
 
+#include "HeadlessRenderer.h"
+#include "MetricsServer.h"
+#include "SingleInstance.h"
 #include "core/ConfigStore.h"
+#include "core/HeapAccounting.h"
+#include "core/IdleScheduler.h"
+#include "core/ImageCache.h"
+#include "core/TaskExecutor.h"
 #include "core/LayoutEngine.h"
+#include "core/PerfMonitor.h"
 #include "core/PluginLoader.h"
+#include "core/PowerProfile.h"
 #include "core/WidgetManager.h"
 #include "ui/DashboardWindow.h"
+#include "ui/Theme.h"
+#include "ui/WidgetFrame.h"
 
-#include <QFile>
+#include <QElapsedTimer>
+#include <QDebug>
+#include <QTimer>
+#include <utility>
 
 namespace dashboard {
 
+static constexpr int kHeapDumpIntervalMs = 60000;
+static constexpr int kFirstPaintWaitMs = 500;
+
 DashboardApp::DashboardApp(int& argc, char** argv) : QApplication(argc, argv) {
     setApplicationName("Dashboard");
     setOrganizationName("Dashboard");
     setApplicationVersion("0.1.0");
 
-    QFile styleFile(":/theme.qss");
-    if (styleFile.open(QFile::ReadOnly)) {
-        setStyleSheet(styleFile.readAll());
+    config_ = std::make_unique<ConfigStore>();
+    Theme::apply(*this, Theme::byName(config_->get(config::theme)));
+
+    const QStringList args = arguments().mid(1);
+    const auto headless = HeadlessOptions::fromArguments(args);
+
+    perfMonitor_ = std::make_unique<PerfMonitor>(config_->get(config::stallThresholdMs));
+    // A headless run may share these files with a running GUI instance
+    perfMonitor_->setLogEnabled(!headless);
+    powerProfile_ = std::make_unique<PowerProfile>(*config_);
+    idleScheduler_ = std::make_unique<IdleScheduler>();
+    taskExecutor_ = std::make_unique<TaskExecutor>();
+    imageCache_ = std::make_unique<ImageCache>();
+    imageCache_->setBudgetBytes(qint64(config_->get(config::imageCacheMb)) * 1024 * 1024);
+    if (HeapAccounting::kEnabled) {
+        // Rewritten periodically so the last figures survive a crash
+        auto* heapDumpTimer = new QTimer(this);
+        connect(heapDumpTimer, &QTimer::timeout, this, []() { HeapAccounting::dump(); });
+        heapDumpTimer->start(kHeapDumpIntervalMs);
+        connect(this, &QCoreApplication::aboutToQuit, this, []() { HeapAccounting::dump(); });
     }
+    frameClock_.start();
+
+    // Later launches forward their arguments here instead of starting up
+    singleInstance_ = std::make_unique<SingleInstance>();
+    if (!headless) {
+        singleInstance_->listen();
+    }
+    connect(singleInstance_.get(), &SingleInstance::activated, this,
+            &DashboardApp::handleArguments);
+
+    // A workspace given on the command line is opened directly rather than switched to.
+    // Only an interactive launch makes it the current workspace for the next start.
+    QString workspace;
+    int workspaceIndex = args.indexOf("--workspace");
+    if (workspaceIndex >= 0 && workspaceIndex + 1 < args.size()
+        && LayoutEngine::workspaceNames().contains(args.at(workspaceIndex + 1))) {
+        workspace = args.at(workspaceIndex + 1);
+        if (!headless) {
+            config_->set(config::currentWorkspace, workspace);
+        }
+    }
+
+    // The window decides when closing means quitting (see keepRunning)
+    setQuitOnLastWindowClosed(false);
 
-    config_ = std::make_unique<ConfigStore>();
     layoutEngine_ = std::make_unique<LayoutEngine>();
-    pluginLoader_ = std::make_unique<PluginLoader>();
+    pluginLoader_ = std::make_unique<PluginLoader>(headless.has_value());
     widgetManager_ = std::make_unique<WidgetManager>(*pluginLoader_);
-    window_ = std::make_unique<DashboardWindow>(*widgetManager_, *config_, *layoutEngine_);
+    window_ = std::make_unique<DashboardWindow>(*widgetManager_, *config_, *layoutEngine_,
+                                                workspace);
+    if (headless) {
+        headlessRenderer_ = std::make_unique<HeadlessRenderer>(*window_, *headless);
+    }
+
+    // The socket path belongs to the GUI instance; listen() would replace its socket
+    const QString metricsSocket = config_->get(config::metricsSocket);
+    if (!metricsSocket.isEmpty() && !headless) {
+        metricsServer_ = std::make_unique<MetricsServer>(*widgetManager_, *window_->canvas());
+        metricsServer_->listen(metricsSocket);
+    }
 }
 
 DashboardApp::~DashboardApp() = default;
 
 int DashboardApp::run() {
     window_->show();
+    if (headlessRenderer_) {
+        headlessRenderer_->start();
+    }
+    // Plugins load once the placeholders are on screen; a window that never
+    // paints (e.g. minimized) stops waiting after a while
+    connect(window_.get(), &DashboardWindow::placeholdersPainted, this, &DashboardApp::restore);
+    QTimer::singleShot(kFirstPaintWaitMs, this, &DashboardApp::restore);
+    window_->showPlaceholders();
+    return exec();
+}
+
+void DashboardApp::restore() {
+    if (restored_) {
+        return;
+    }
     widgetManager_->loadPlugins();
     window_->restoreLayout();
-    return exec();
+    restored_ = true;
+
+    handleArguments(arguments().mid(1));
+    for (const auto& forwarded : std::exchange(pendingArguments_, {})) {
+        handleArguments(forwarded);
+    }
+}
+
+void DashboardApp::handleArguments(const QStringList& arguments) {
+    // Commands need plugins; hold them until the first restore has run
+    if (!restored_) {
+        pendingArguments_.append(arguments);
+        return;
+    }
+    bool quit = false;
+    for (int i = 0; i < arguments.size(); ++i) {
+        const QString& arg = arguments.at(i);
+        const bool hasValue = i + 1 < arguments.size();
+        if (arg == "--add-widget" && hasValue) {
+            if (!window_->addWidgetByName(arguments.at(++i))) {
+                qWarning() << "No widget plugin named" << arguments.at(i);
+            }
+        } else if (arg == "--workspace" && hasValue) {
+            const QString name = arguments.at(++i);
+            if (LayoutEngine::workspaceNames().contains(name)) {
+                window_->switchWorkspace(name);
+            }
+        } else if (arg == "--quit") {
+            quit = true;
+        }
+    }
+    if (quit) {
+        window_->quit();
+    } else {
+        window_->activate();
+    }
+}
+
+bool DashboardApp::deferFrame(QWidget* window) {
+    if (deferredFrames_.contains(window)) {
+        return true;
+    }
+    const qint64 now = frameClock_.elapsed();
+    const qint64 wait = lastFrameMs_.value(window, -PowerProfile::kLowPowerFrameIntervalMs)
+                        + PowerProfile::kLowPowerFrameIntervalMs - now;
+    if (wait <= 0) {
+        lastFrameMs_[window] = now;
+        return false;
+    }
+    // Dirty regions keep accumulating until the postponed request repaints them at once
+    deferredFrames_.insert(window);
+    QTimer::singleShot(wait, window, [this, window]() {
+        deferredFrames_.remove(window);
+        postEvent(window, new QEvent(QEvent::UpdateRequest), Qt::LowEventPriority);
+    });
+    return true;
+}
+
+WidgetFrame* DashboardApp::contentFrame(QWidget* widget) {
+    // The frame's own chrome (drag, resize, delete button) is host code
+    WidgetFrame* frame = nullptr;
+    QWidget* child = widget;
+    for (QWidget* w = child->parentWidget(); w && !child->isWindow(); w = w->parentWidget()) {
+        if ((frame = qobject_cast<WidgetFrame*>(w))) {
+            break;
+        }
+        child = w;
+    }
+    return frame && child == frame->contentWidget() ? frame : nullptr;
+}
+
+bool DashboardApp::notify(QObject* receiver, QEvent* event) {
+    if (!perfMonitor_) {
+        return QApplication::notify(receiver, event);
+    }
+    if (!receiver->isWidgetType()) {
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+        // Timers, queued slots and the like of a plugin's objects run its code too
+        QObject* owner = receiver->parent();
+        while (owner && !owner->isWidgetType()) {
+            owner = owner->parent();
+        }
+        if (owner) {
+            if (WidgetFrame* frame = contentFrame(static_cast<QWidget*>(owner))) {
+                PluginScope scope(
+                    perfMonitor_->stats(frame, frame->pluginName(), frame->widgetId()),
+                    PluginCall::Event);
+                return QApplication::notify(receiver, event);
+            }
+        }
+#endif
+        return QApplication::notify(receiver, event);
+    }
+
+    // An UpdateRequest on a window repaints everything dirty in it: one frame
+    if (event->type() == QEvent::UpdateRequest && static_cast<QWidget*>(receiver)->isWindow()) {
+        if (powerProfile_ && powerProfile_->isLowPower() && deferFrame(static_cast<QWidget*>(receiver))) {
+            return true;
+        }
+        QElapsedTimer timer;
+        timer.start();
+        bool handled = QApplication::notify(receiver, event);
+        perfMonitor_->recordFrame(timer.nsecsElapsed());
+        return handled;
+    }
+
+    // Attribute events delivered inside a widget card to that card's plugin instance.
+    WidgetFrame* frame = contentFrame(static_cast<QWidget*>(receiver));
+    if (!frame) {
+        return QApplication::notify(receiver, event);
+    }
+
+    PluginScope scope(perfMonitor_->stats(frame, frame->pluginName(), frame->widgetId()),
+                      event->type() == QEvent::Paint ? PluginCall::Paint : PluginCall::Event);
+    return QApplication::notify(receiver, event);
 }
 
 }  // namespace dashboard
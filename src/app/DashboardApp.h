@@ -16,6 +16,10 @@
 #pragma once
 
 #include <QApplication>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QSet>
+#include <QStringList>
 #include <memory>
 
 namespace dashboard {
@@ -25,6 +29,15 @@ class LayoutEngine;
 class PluginLoader;
 class WidgetManager;
 class DashboardWindow;
+class PerfMonitor;
+class PowerProfile;
+class IdleScheduler;
+class TaskExecutor;
+class ImageCache;
+class SingleInstance;
+class MetricsServer;
+class HeadlessRenderer;
+class WidgetFrame;
 
 class DashboardApp : public QApplication {
     Q_OBJECT
@@ -35,12 +48,38 @@ public:
 
     int run();
 
+    bool notify(QObject* receiver, QEvent* event) override;
+
 private:
+    // Handles --add-widget, --workspace and --quit from this or a later launch.
+    void handleArguments(const QStringList& arguments);
+    // Loads plugins and fills in the placeholders; runs once
+    void restore();
+    // Low-power frame cap: holds back a window repaint that comes too soon
+    bool deferFrame(QWidget* window);
+    // The card whose content contains widget, or null for host widgets
+    static WidgetFrame* contentFrame(QWidget* widget);
+
     std::unique_ptr<ConfigStore> config_;
+    std::unique_ptr<PerfMonitor> perfMonitor_;
+    std::unique_ptr<PowerProfile> powerProfile_;
+    std::unique_ptr<IdleScheduler> idleScheduler_;
+    // Before window_: running jobs finish after the window is gone
+    std::unique_ptr<TaskExecutor> taskExecutor_;
+    std::unique_ptr<ImageCache> imageCache_;
+    std::unique_ptr<SingleInstance> singleInstance_;
     std::unique_ptr<LayoutEngine> layoutEngine_;
     std::unique_ptr<PluginLoader> pluginLoader_;
     std::unique_ptr<WidgetManager> widgetManager_;
     std::unique_ptr<DashboardWindow> window_;
+    std::unique_ptr<MetricsServer> metricsServer_;
+    std::unique_ptr<HeadlessRenderer> headlessRenderer_;
+    QList<QStringList> pendingArguments_;
+    bool restored_ = false;
+
+    QElapsedTimer frameClock_;
+    QHash<const QWidget*, qint64> lastFrameMs_;
+    QSet<const QWidget*> deferredFrames_;
 };
 
 }  // namespace dashboard
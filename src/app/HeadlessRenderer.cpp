@@ -0,0 +1,223 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "HeadlessRenderer.h"
+
+#include "ui/DashboardWindow.h"
+#include "ui/WidgetCanvas.h"
+
+#include <QChildEvent>
+#include <QDebug>
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPaintEvent>
+#include <QPainter>
+#include <QSaveFile>
+
+namespace dashboard {
+
+// Beyond this many rectangles a panel refresh of their bounding box is cheaper
+static constexpr int kMaxDamageRects = 16;
+
+std::optional<HeadlessOptions> HeadlessOptions::fromArguments(const QStringList& arguments) {
+    int index = arguments.indexOf("--headless");
+    if (index < 0 || index + 1 >= arguments.size() || arguments.at(index + 1).startsWith("--")) {
+        return std::nullopt;
+    }
+    HeadlessOptions options;
+    options.outputDir = arguments.at(index + 1);
+    for (int i = 0; i + 1 < arguments.size(); ++i) {
+        const QString& arg = arguments.at(i);
+        const QString& value = arguments.at(i + 1);
+        if (arg == "--size") {
+            const QStringList parts = value.split('x');
+            QSize size = parts.size() == 2 ? QSize(parts[0].toInt(), parts[1].toInt()) : QSize();
+            if (size.width() > 0 && size.height() > 0) {
+                options.size = size;
+            }
+        } else if (arg == "--interval") {
+            options.intervalMs = qMax(50, value.toInt());
+        } else if (arg == "--format") {
+            options.format = value == "raw" ? Format::Raw : Format::Png;
+        }
+    }
+    return options;
+}
+
+HeadlessRenderer::HeadlessRenderer(DashboardWindow& window, const HeadlessOptions& options,
+                                   QObject* parent)
+    : QObject(parent), window_(window), canvas_(*window.canvas()), options_(options) {
+    // Rendering at a fixed size must not rewrite the user's layout or settings
+    window_.setReadOnly(true);
+    timer_.setInterval(options_.intervalMs);
+    connect(&timer_, &QTimer::timeout, this, &HeadlessRenderer::renderDamage);
+}
+
+HeadlessRenderer::Launch HeadlessRenderer::prepare(int argc, char** argv) {
+    QStringList arguments;
+    for (int i = 1; i < argc; ++i) {
+        arguments.append(QString::fromLocal8Bit(argv[i]));
+    }
+    if (!arguments.contains("--headless")) {
+        return Launch::Gui;
+    }
+    if (!HeadlessOptions::fromArguments(arguments)) {
+        qWarning("Usage: dashboard %s", HeadlessOptions::kUsage);
+        return Launch::UsageError;
+    }
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    return Launch::Headless;
+}
+
+void HeadlessRenderer::start() {
+    QDir().mkpath(options_.outputDir);
+    window_.resizeViewport(options_.size);
+
+    frame_ = QImage(options_.size, QImage::Format_RGB32);
+    if (options_.format == HeadlessOptions::Format::Raw) {
+        raw_.setFileName(options_.outputDir + "/frame.raw");
+        if (!raw_.open(QIODevice::ReadWrite) || !raw_.resize(frame_.sizeInBytes())) {
+            qWarning() << "Headless output unavailable:" << raw_.fileName() << raw_.errorString();
+        }
+    }
+
+    watch(&canvas_);
+    // The first output is always the whole frame
+    damage_ = QRegion(canvas_.visibleRect());
+    timer_.start();
+}
+
+void HeadlessRenderer::watch(QWidget* widget) {
+    widget->installEventFilter(this);
+    for (QObject* child : widget->children()) {
+        if (child->isWidgetType()) {
+            watch(static_cast<QWidget*>(child));
+        }
+    }
+}
+
+bool HeadlessRenderer::eventFilter(QObject* watched, QEvent* event) {
+    if (event->type() == QEvent::ChildAdded) {
+        QObject* child = static_cast<QChildEvent*>(event)->child();
+        if (child->isWidgetType()) {
+            watch(static_cast<QWidget*>(child));
+        }
+    } else if (event->type() == QEvent::Paint && !rendering_) {
+        // Whatever the offscreen backing store repainted is what changed
+        auto* widget = static_cast<QWidget*>(watched);
+        const QPoint offset = widget == &canvas_ ? QPoint() : widget->mapTo(&canvas_, QPoint());
+        damage_ += static_cast<QPaintEvent*>(event)->region().translated(offset);
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void HeadlessRenderer::renderDamage() {
+    const QRect visible = canvas_.visibleRect();
+    QRegion damage = damage_ & visible;
+    damage_ = QRegion();
+    if (damage.isEmpty()) {
+        return;
+    }
+    QList<QRect> rects(damage.begin(), damage.end());
+    if (rects.size() > kMaxDamageRects) {
+        rects = {damage.boundingRect()};
+    }
+
+    rendering_ = true;
+    QPainter painter(&frame_);
+    for (const QRect& rect : rects) {
+        const QPoint target = rect.topLeft() - visible.topLeft();
+        painter.fillRect(QRect(target, rect.size()), Qt::black);
+        canvas_.render(&painter, target, QRegion(rect));
+    }
+    painter.end();
+    rendering_ = false;
+
+    // Output rectangles are in frame coordinates from here on
+    for (QRect& rect : rects) {
+        rect.translate(-visible.topLeft());
+    }
+    QStringList files;
+    if (options_.format == HeadlessOptions::Format::Raw) {
+        writeRaw(rects);
+    } else {
+        writePng(rects, files);
+    }
+    ++sequence_;
+    writeSidecar(rects, files);
+}
+
+void HeadlessRenderer::writePng(const QList<QRect>& rects, QStringList& files) {
+    const QDir dir(options_.outputDir);
+    for (int i = 0; i < rects.size(); ++i) {
+        const QString name = QString("tile-%1.png").arg(i);
+        frame_.copy(rects[i]).save(dir.filePath(name), "PNG");
+        files.append(name);
+    }
+    for (int i = rects.size(); i < tileCount_; ++i) {
+        QFile::remove(dir.filePath(QString("tile-%1.png").arg(i)));
+    }
+    tileCount_ = rects.size();
+}
+
+void HeadlessRenderer::writeRaw(const QList<QRect>& rects) {
+    if (!raw_.isOpen()) {
+        return;
+    }
+    // XRGB8888 rows of the full frame; only the damaged spans are rewritten
+    const qint64 bytesPerLine = frame_.bytesPerLine();
+    for (const QRect& rect : rects) {
+        const qint64 spanBytes = qint64(rect.width()) * 4;
+        for (int y = rect.top(); y <= rect.bottom(); ++y) {
+            const qint64 offset = y * bytesPerLine + qint64(rect.left()) * 4;
+            raw_.seek(offset);
+            raw_.write(reinterpret_cast<const char*>(frame_.constScanLine(y)) + rect.left() * 4,
+                       spanBytes);
+        }
+    }
+    raw_.flush();
+}
+
+void HeadlessRenderer::writeSidecar(const QList<QRect>& rects, const QStringList& files) {
+    QJsonArray list;
+    for (int i = 0; i < rects.size(); ++i) {
+        const QRect& rect = rects[i];
+        QJsonObject entry{{"x", rect.x()},
+                          {"y", rect.y()},
+                          {"width", rect.width()},
+                          {"height", rect.height()}};
+        if (i < files.size()) {
+            entry["file"] = files[i];
+        }
+        list.append(entry);
+    }
+    QJsonObject sidecar{
+        {"sequence", qint64(sequence_)},
+        {"width", frame_.width()},
+        {"height", frame_.height()},
+        {"format", options_.format == HeadlessOptions::Format::Raw ? "xrgb8888" : "png"},
+        {"rects", list},
+    };
+    // Written last and atomically: a reader that sees a new sequence sees its pixels
+    QSaveFile file(QDir(options_.outputDir).filePath("damage.json"));
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(QJsonDocument(sidecar).toJson(QJsonDocument::Compact));
+        file.commit();
+    }
+}
+
+}  // namespace dashboard
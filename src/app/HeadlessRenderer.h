@@ -0,0 +1,91 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QFile>
+#include <QImage>
+#include <QObject>
+#include <QRegion>
+#include <QSize>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <optional>
+
+namespace dashboard {
+
+class DashboardWindow;
+class WidgetCanvas;
+
+struct HeadlessOptions {
+    enum class Format { Png, Raw };
+
+    QString outputDir;
+    QSize size{800, 480};
+    int intervalMs = 1000;
+    Format format = Format::Png;
+
+    static constexpr const char* kUsage =
+        "--headless <dir> [--size WxH] [--interval ms] [--format png|raw]";
+
+    // Parses kUsage; nullopt without --headless or its directory.
+    static std::optional<HeadlessOptions> fromArguments(const QStringList& arguments);
+};
+
+// Renders the canvas of an offscreen dashboard window to files for e-ink and
+// other panels driven without a compositor. Only regions repainted since the
+// last output are rendered and written; damage.json lists them so a panel
+// driver can do a partial refresh.
+class HeadlessRenderer : public QObject {
+    Q_OBJECT
+
+public:
+    HeadlessRenderer(DashboardWindow& window, const HeadlessOptions& options,
+                     QObject* parent = nullptr);
+
+    enum class Launch { Gui, Headless, UsageError };
+
+    // Selects the offscreen platform when argv asks for headless mode, using the
+    // same parsing as HeadlessOptions::fromArguments. `--headless` without an
+    // output directory prints the usage and returns UsageError. Must run before
+    // the QApplication is created.
+    static Launch prepare(int argc, char** argv);
+
+    void start();
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    void watch(QWidget* widget);
+    void renderDamage();
+    void writePng(const QList<QRect>& rects, QStringList& files);
+    void writeRaw(const QList<QRect>& rects);
+    void writeSidecar(const QList<QRect>& rects, const QStringList& files);
+
+    DashboardWindow& window_;
+    WidgetCanvas& canvas_;
+    HeadlessOptions options_;
+    QTimer timer_;
+    QImage frame_;
+    QFile raw_;
+    QRegion damage_;
+    quint64 sequence_ = 0;
+    int tileCount_ = 0;
+    bool rendering_ = false;
+};
+
+}  // namespace dashboard
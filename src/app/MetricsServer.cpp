@@ -0,0 +1,310 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "MetricsServer.h"
+
+#include "core/IdleScheduler.h"
+#include "core/ImageCache.h"
+#include "core/Metrics.h"
+#include "core/PerfMonitor.h"
+#include "core/PowerProfile.h"
+#include "core/ProcessMemory.h"
+#include "core/WidgetManager.h"
+#include "ui/ContentCache.h"
+#include "ui/WidgetCanvas.h"
+#include "ui/WidgetFrame.h"
+
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QLocalSocket>
+#include <QTimer>
+#include <array>
+#include <sys/resource.h>
+#include <sys/stat.h>
+
+namespace dashboard {
+
+// Plain clients send nothing; wait this long for an HTTP request line first
+static constexpr int kRequestWaitMs = 100;
+
+namespace {
+
+QByteArray escapeLabel(const QString& value) {
+    QByteArray out = value.toUtf8();
+    out.replace('\\', "\\\\").replace('"', "\\\"").replace('\n', "\\n");
+    return out;
+}
+
+QByteArray seconds(double value) {
+    return QByteArray::number(value, 'g', 9);
+}
+
+class Writer {
+public:
+    void header(const char* name, const char* type, const char* help) {
+        out_ += QByteArray("# HELP ") + name + ' ' + help + '\n';
+        out_ += QByteArray("# TYPE ") + name + ' ' + type + '\n';
+    }
+
+    void sample(const QByteArray& name, const QByteArray& labels, const QByteArray& value) {
+        out_ += name;
+        if (!labels.isEmpty()) {
+            out_ += '{' + labels + '}';
+        }
+        out_ += ' ' + value + '\n';
+    }
+
+    // PerfMonitor buckets are in ms with an open-ended last bucket (bound 0)
+    template <size_t N>
+    void histogram(const char* name, const std::array<int, N>& boundsMs,
+                   const std::array<quint64, N>& counts, double sumSeconds) {
+        quint64 cumulative = 0;
+        for (size_t i = 0; i < N; ++i) {
+            cumulative += counts[i];
+            const QByteArray le = boundsMs[i] > 0 ? seconds(boundsMs[i] / 1000.0) : "+Inf";
+            sample(QByteArray(name) + "_bucket", "le=\"" + le + '"', QByteArray::number(cumulative));
+        }
+        sample(QByteArray(name) + "_sum", {}, seconds(sumSeconds));
+        sample(QByteArray(name) + "_count", {}, QByteArray::number(cumulative));
+    }
+
+    QByteArray take() { return std::move(out_); }
+
+private:
+    QByteArray out_;
+};
+
+}  // namespace
+
+MetricsServer::MetricsServer(WidgetManager& widgetManager, WidgetCanvas& canvas, QObject* parent)
+    : QObject(parent), widgetManager_(widgetManager), canvas_(canvas) {
+    connect(&server_, &QLocalServer::newConnection, this, &MetricsServer::onNewConnection);
+}
+
+bool MetricsServer::listen(const QString& path) {
+    // A socket left by a crashed run is replaced; anything else at the
+    // user-configured path is left alone. Relative names live in the temp dir
+    // (see QLocalServer::listen).
+    const QString file = QDir::isAbsolutePath(path) ? path : QDir::tempPath() + '/' + path;
+    struct stat st;
+    if (::lstat(QFile::encodeName(file).constData(), &st) == 0) {
+        if (!S_ISSOCK(st.st_mode)) {
+            qWarning() << "Metrics socket path exists and is not a socket:" << file;
+            return false;
+        }
+        QLocalServer::removeServer(path);
+    }
+    server_.setSocketOptions(QLocalServer::UserAccessOption);
+    if (!server_.listen(path)) {
+        qWarning() << "Metrics socket unavailable:" << path << server_.errorString();
+        return false;
+    }
+    return true;
+}
+
+QByteArray MetricsServer::render() const {
+    Writer w;
+
+    if (PerfMonitor* monitor = PerfMonitor::instance()) {
+        w.header("dashboard_event_loop_heartbeat_age_seconds", "gauge",
+                 "Time since the event loop last turned over.");
+        w.sample("dashboard_event_loop_heartbeat_age_seconds", {},
+                 seconds(monitor->heartbeatAgeMs() / 1000.0));
+
+        w.header("dashboard_event_loop_stall_seconds", "histogram",
+                 "Event-loop stalls longer than the configured threshold.");
+        w.histogram("dashboard_event_loop_stall_seconds", PerfMonitor::stallBucketBounds(),
+                    monitor->stallHistogram(), monitor->stallTotalMs() / 1000.0);
+
+        const FrameStats& frames = monitor->frameStats();
+        w.header("dashboard_frame_seconds", "histogram", "Time to repaint a window.");
+        w.histogram("dashboard_frame_seconds", PerfMonitor::frameBucketBounds(),
+                    frames.histogram, frames.totalNs / 1e9);
+
+        w.header("dashboard_plugin_calls_total", "counter",
+                 "Host calls into plugin code per widget instance.");
+        w.header("dashboard_plugin_call_seconds_total", "counter",
+                 "Time spent in plugin code per widget instance.");
+        w.header("dashboard_plugin_call_max_seconds", "gauge",
+                 "Slowest single plugin call per widget instance.");
+        for (const InstanceStats* stats : monitor->allStats()) {
+            const QByteArray instance = "plugin=\"" + escapeLabel(stats->pluginName)
+                                        + "\",instance=\"" + escapeLabel(stats->instanceId)
+                                        + "\",call=\"";
+            for (int i = 0; i < kPluginCallKinds; ++i) {
+                const PluginCallStats& call = stats->calls[i];
+                if (call.count == 0) {
+                    continue;
+                }
+                const QByteArray labels =
+                    instance + pluginCallName(static_cast<PluginCall>(i)) + '"';
+                w.sample("dashboard_plugin_calls_total", labels, QByteArray::number(call.count));
+                w.sample("dashboard_plugin_call_seconds_total", labels,
+                         seconds(call.totalNs / 1e9));
+                w.sample("dashboard_plugin_call_max_seconds", labels, seconds(call.maxNs / 1e9));
+            }
+        }
+    }
+
+    w.header("dashboard_plugin_load_seconds", "gauge",
+             "Time to load each widget plugin; only plugins loaded since start.");
+    int loadedPlugins = 0;
+    for (const PluginInfo& info : widgetManager_.plugins()) {
+        // Indexed from metadata without loading: no load time to report
+        if (info.loadTimeNs > 0) {
+            w.sample("dashboard_plugin_load_seconds", "plugin=\"" + escapeLabel(info.name) + '"',
+                     seconds(info.loadTimeNs / 1e9));
+        }
+        loadedPlugins += widgetManager_.isLoaded(info.name) ? 1 : 0;
+    }
+    const int knownPlugins = int(widgetManager_.plugins().size());
+    w.header("dashboard_plugins", "gauge", "Widget plugins by library state.");
+    w.sample("dashboard_plugins", "state=\"loaded\"", QByteArray::number(loadedPlugins));
+    w.sample("dashboard_plugins", "state=\"unloaded\"",
+             QByteArray::number(knownPlugins - loadedPlugins));
+
+    int live = 0, frozen = 0, placeholders = 0;
+    for (const WidgetFrame* frame : canvas_.frames()) {
+        if (frame->isPlaceholder()) {
+            ++placeholders;
+        } else if (frame->isFrozen()) {
+            ++frozen;
+        } else {
+            ++live;
+        }
+    }
+    w.header("dashboard_frames", "gauge", "Widget cards on the canvas by state.");
+    w.sample("dashboard_frames", "state=\"live\"", QByteArray::number(live));
+    w.sample("dashboard_frames", "state=\"frozen\"", QByteArray::number(frozen));
+    w.sample("dashboard_frames", "state=\"placeholder\"", QByteArray::number(placeholders));
+
+    const ContentCache::Stats cache = canvas_.contentCache().stats();
+    w.header("dashboard_card_snapshots_resting", "gauge",
+             "Live cards currently painted from a cached snapshot.");
+    w.sample("dashboard_card_snapshots_resting", {}, QByteArray::number(cache.resting));
+    w.header("dashboard_card_snapshot_hits_total", "counter",
+             "Card paints served from a cached snapshot.");
+    w.sample("dashboard_card_snapshot_hits_total", {}, QByteArray::number(cache.hits));
+    w.header("dashboard_card_snapshot_misses_total", "counter",
+             "Card paints that rendered the live content.");
+    w.sample("dashboard_card_snapshot_misses_total", {}, QByteArray::number(cache.misses));
+    w.header("dashboard_card_snapshot_invalidations_total", "counter",
+             "Cached snapshots dropped because the card's content changed.");
+    w.sample("dashboard_card_snapshot_invalidations_total", {},
+             QByteArray::number(cache.invalidations));
+
+    static constexpr const char* kStoreNames[metrics::kStoreKinds] = {"layout", "widget_data"};
+    w.header("dashboard_persistence_writes_total", "counter", "Files written by the dashboard.");
+    w.header("dashboard_persistence_bytes_total", "counter", "Bytes written by the dashboard.");
+    for (int i = 0; i < metrics::kStoreKinds; ++i) {
+        const QByteArray labels = QByteArray("store=\"") + kStoreNames[i] + '"';
+        const auto& counters = metrics::storeCounters[i];
+        w.sample("dashboard_persistence_writes_total", labels,
+                 QByteArray::number(counters.writes.load(std::memory_order_relaxed)));
+        w.sample("dashboard_persistence_bytes_total", labels,
+                 QByteArray::number(counters.bytes.load(std::memory_order_relaxed)));
+    }
+
+    w.header("dashboard_restore_seconds", "gauge",
+             "Latest layout restore: visible cards painted, and all cards created.");
+    const qint64 firstPaintMs = metrics::restoreFirstPaintMs.load(std::memory_order_relaxed);
+    const qint64 completeMs = metrics::restoreCompleteMs.load(std::memory_order_relaxed);
+    if (firstPaintMs >= 0) {
+        w.sample("dashboard_restore_seconds", "phase=\"first_paint\"", seconds(firstPaintMs / 1000.0));
+    }
+    if (completeMs >= 0) {
+        w.sample("dashboard_restore_seconds", "phase=\"complete\"", seconds(completeMs / 1000.0));
+    }
+
+    w.header("dashboard_resident_memory_bytes", "gauge", "Resident set size of the process.");
+    w.sample("dashboard_resident_memory_bytes", {}, QByteArray::number(ProcessMemory::residentBytes()));
+
+    // CPU time and voluntary context switches (wakeups) to compare power profiles
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        const auto cpu = [](const timeval& tv) { return tv.tv_sec + tv.tv_usec / 1e6; };
+        w.header("process_cpu_seconds_total", "counter", "User and system CPU time.");
+        w.sample("process_cpu_seconds_total", {}, seconds(cpu(usage.ru_utime) + cpu(usage.ru_stime)));
+        w.header("dashboard_voluntary_context_switches_total", "counter",
+                 "Times the process blocked and was woken again.");
+        w.sample("dashboard_voluntary_context_switches_total", {},
+                 QByteArray::number(qint64(usage.ru_nvcsw)));
+    }
+    if (IdleScheduler* idle = IdleScheduler::instance()) {
+        const IdleScheduler::Stats work = idle->stats();
+        w.header("dashboard_deferred_work_seconds_total", "counter",
+                 "Time spent in deferred host tasks, by whether the event loop was idle.");
+        w.sample("dashboard_deferred_work_seconds_total", "path=\"idle\"",
+                 seconds(work.idleNs / 1e9));
+        w.sample("dashboard_deferred_work_seconds_total", "path=\"critical\"",
+                 seconds(work.criticalNs / 1e9));
+        w.header("dashboard_deferred_tasks_pending", "gauge", "Deferred host tasks waiting to run.");
+        w.sample("dashboard_deferred_tasks_pending", {}, QByteArray::number(work.pending));
+    }
+    if (ImageCache* images = ImageCache::instance()) {
+        const ImageCache::Stats cache = images->stats();
+        w.header("dashboard_image_cache_lookups_total", "counter",
+                 "Shared image cache lookups, by whether the image was cached.");
+        w.sample("dashboard_image_cache_lookups_total", "result=\"hit\"",
+                 QByteArray::number(cache.hits));
+        w.sample("dashboard_image_cache_lookups_total", "result=\"miss\"",
+                 QByteArray::number(cache.misses));
+        w.header("dashboard_image_cache_evictions_total", "counter",
+                 "Decoded images dropped to stay within the memory budget.");
+        w.sample("dashboard_image_cache_evictions_total", {}, QByteArray::number(cache.evictions));
+        w.header("dashboard_image_cache_bytes", "gauge", "Memory held by decoded images.");
+        w.sample("dashboard_image_cache_bytes", {}, QByteArray::number(cache.bytes));
+    }
+    if (PowerProfile* power = PowerProfile::instance()) {
+        w.header("dashboard_low_power", "gauge", "1 while the low-power rendering profile is active.");
+        w.sample("dashboard_low_power", {}, power->isLowPower() ? "1" : "0");
+    }
+
+    return w.take();
+}
+
+void MetricsServer::onNewConnection() {
+    while (QLocalSocket* socket = server_.nextPendingConnection()) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+
+        // Answer once: on an HTTP request line, or plain text after a short wait
+        auto* timer = new QTimer(socket);
+        timer->setSingleShot(true);
+        auto respond = [this, socket, timer]() {
+            if (socket->state() != QLocalSocket::ConnectedState) {
+                return;
+            }
+            timer->stop();
+            const QByteArray body = render();
+            if (socket->peek(3) == "GET") {
+                socket->write("HTTP/1.0 200 OK\r\n"
+                              "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                              "Content-Length: " + QByteArray::number(body.size()) + "\r\n\r\n");
+            }
+            socket->write(body);
+            socket->disconnectFromServer();
+        };
+        connect(timer, &QTimer::timeout, socket, respond);
+        connect(socket, &QLocalSocket::readyRead, socket, [socket, respond]() {
+            if (socket->canReadLine()) {
+                respond();
+            }
+        });
+        timer->start(kRequestWaitMs);
+    }
+}
+
+}  // namespace dashboard
@@ -0,0 +1,50 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QLocalServer>
+#include <QObject>
+#include <QString>
+
+namespace dashboard {
+
+class WidgetCanvas;
+class WidgetManager;
+
+// Opt-in Prometheus text exposition on a Unix socket (diagnostics/metricsSocket).
+// Everything is read from counters the hot paths already keep, and the text is
+// only formatted when a client connects. Plain clients (socat, nc -U) get the
+// text straight away; a request line starting with GET is answered as HTTP so
+// `curl --unix-socket` works too.
+class MetricsServer : public QObject {
+    Q_OBJECT
+
+public:
+    MetricsServer(WidgetManager& widgetManager, WidgetCanvas& canvas, QObject* parent = nullptr);
+
+    bool listen(const QString& path);
+    QByteArray render() const;
+
+private:
+    void onNewConnection();
+
+    WidgetManager& widgetManager_;
+    WidgetCanvas& canvas_;
+    QLocalServer server_;
+};
+
+}  // namespace dashboard
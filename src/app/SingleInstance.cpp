@@ -0,0 +1,124 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "SingleInstance.h"
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QLocalSocket>
+#include <QStandardPaths>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace dashboard {
+
+static constexpr int kReplyTimeoutMs = 2000;
+
+SingleInstance::SingleInstance(QObject* parent) : QObject(parent) {
+    connect(&server_, &QLocalServer::newConnection, this, &SingleInstance::onNewConnection);
+}
+
+QString SingleInstance::socketPath() {
+    // Per-user and independent of QCoreApplication, so it resolves before one exists
+    return QStandardPaths::writableLocation(QStandardPaths::RuntimeLocation) + "/dashboard.sock";
+}
+
+bool SingleInstance::forward(int argc, char** argv) {
+    // Plain POSIX so a second launch never pays for Qt application start-up
+    const QByteArray path = QFile::encodeName(socketPath());
+    sockaddr_un addr{};
+    if (path.size() >= int(sizeof(addr.sun_path))) {
+        return false;
+    }
+    addr.sun_family = AF_UNIX;
+    memcpy(addr.sun_path, path.constData(), path.size());
+
+    int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return false;
+    }
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        ::close(fd);
+        return false;
+    }
+
+    QJsonArray arguments;
+    for (int i = 1; i < argc; ++i) {
+        arguments.append(QString::fromLocal8Bit(argv[i]));
+    }
+    QByteArray message = QJsonDocument(arguments).toJson(QJsonDocument::Compact) + '\n';
+    const char* data = message.constData();
+    qsizetype remaining = message.size();
+    while (remaining > 0) {
+        // send() rather than write(): a primary that hangs up early must not SIGPIPE us
+        ssize_t written = ::send(fd, data, size_t(remaining), MSG_NOSIGNAL);
+        if (written < 0 && errno == EINTR) {
+            continue;
+        }
+        if (written <= 0) {
+            ::close(fd);
+            return false;
+        }
+        data += written;
+        remaining -= written;
+    }
+
+    // Wait for the acknowledgement so the caller knows the command was taken
+    pollfd pfd{fd, POLLIN, 0};
+    char reply[8] = {};
+    bool acknowledged =
+        ::poll(&pfd, 1, kReplyTimeoutMs) > 0 && ::read(fd, reply, sizeof(reply)) > 0;
+    ::close(fd);
+    return acknowledged;
+}
+
+bool SingleInstance::listen() {
+    // Left behind by a crashed instance; the lock file already proved we are alone
+    QLocalServer::removeServer(socketPath());
+    server_.setSocketOptions(QLocalServer::UserAccessOption);
+    if (!server_.listen(socketPath())) {
+        qWarning() << "Activation socket unavailable:" << server_.errorString();
+        return false;
+    }
+    return true;
+}
+
+void SingleInstance::onNewConnection() {
+    while (QLocalSocket* socket = server_.nextPendingConnection()) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+        connect(socket, &QLocalSocket::readyRead, this, [this, socket]() {
+            if (!socket->canReadLine()) {
+                return;
+            }
+            QJsonArray array = QJsonDocument::fromJson(socket->readLine()).array();
+            QStringList arguments;
+            for (const auto& value : array) {
+                arguments.append(value.toString());
+            }
+            socket->write("ok\n");
+            socket->flush();
+            socket->disconnectFromServer();
+            emit activated(arguments);
+        });
+    }
+}
+
+}  // namespace dashboard
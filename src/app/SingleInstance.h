@@ -0,0 +1,49 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QLocalServer>
+#include <QObject>
+#include <QStringList>
+
+namespace dashboard {
+
+// Activation channel between dashboard launches. The running instance
+// listens on a Unix socket; a later launch connects before creating any Qt
+// application object, forwards its arguments and exits.
+class SingleInstance : public QObject {
+    Q_OBJECT
+
+public:
+    explicit SingleInstance(QObject* parent = nullptr);
+
+    // Sends argv to a running instance. Returns false if none is listening.
+    static bool forward(int argc, char** argv);
+    static QString socketPath();
+
+    bool listen();
+
+signals:
+    // Arguments of a later launch, without the program name.
+    void activated(const QStringList& arguments);
+
+private:
+    void onNewConnection();
+
+    QLocalServer server_;
+};
+
+}  // namespace dashboard
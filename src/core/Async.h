@@ -0,0 +1,293 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QCoreApplication>
+#include <QFile>
+#include <QObject>
+#include <QProcess>
+#include <QStringList>
+#include <QThread>
+#include <QThreadPool>
+#include <QTimer>
+#include <atomic>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <qlogging.h>
+
+// C++20 coroutine support built on Qt only, so widgets can use it without
+// linking against the host. A coroutine returning Async starts immediately and
+// runs until its first co_await; the awaitables below move it between the
+// GUI thread and thread pools (see TaskExecutor for the host's pools).
+//
+//     Async MyWidget::reload(Lifetime lifetime) {
+//         auto bytes = co_await runOn(pool, 0, [path]() { return readAndParse(path); });
+//         applyData(bytes);  // back on the GUI thread, and this widget still exists
+//     }
+//     reload(Lifetime(this));
+
+namespace dashboard {
+
+// Cancellation for coroutines, tied to a QObject. A coroutine that takes a
+// Lifetime parameter is destroyed instead of resumed at its next suspension
+// point once the owner is gone, so no continuation runs against a deleted card.
+// Bind widget work to the content widget: it is deleted with its WidgetFrame.
+class Lifetime {
+public:
+    explicit Lifetime(QObject* owner) : cancelled_(std::make_shared<std::atomic<bool>>(false)) {
+        QObject::connect(owner, &QObject::destroyed,
+                         [cancelled = cancelled_]() { cancelled->store(true); });
+    }
+
+    bool isCancelled() const { return cancelled_->load(); }
+    // Abandons the coroutines bound to it while the owner lives on
+    void cancel() { cancelled_->store(true); }
+
+private:
+    std::shared_ptr<std::atomic<bool>> cancelled_;
+};
+
+// Fire-and-forget coroutine. Its frame is freed when it finishes or is cancelled.
+class Async {
+public:
+    struct promise_type {
+        template <typename... Args>
+        explicit promise_type(const Args&... args) {
+            (bind(args), ...);
+        }
+
+        Async get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { qWarning("Exception escaped an Async coroutine"); }
+
+        bool isCancelled() const { return lifetime && lifetime->isCancelled(); }
+
+        std::optional<Lifetime> lifetime;
+
+    private:
+        // The first Lifetime among the coroutine's parameters
+        void bind(const Lifetime& bound) {
+            if (!lifetime) {
+                lifetime = bound;
+            }
+        }
+        template <typename T>
+        void bind(const T&) {}
+    };
+};
+
+namespace detail {
+
+using AsyncHandle = std::coroutine_handle<Async::promise_type>;
+
+inline bool onGuiThread() {
+    return QThread::currentThread() == QCoreApplication::instance()->thread();
+}
+
+// Continues the coroutine on the GUI thread, or frees it there if cancelled
+inline void resumeOnGui(AsyncHandle handle) {
+    QMetaObject::invokeMethod(
+        QCoreApplication::instance(),
+        [handle]() {
+            if (handle.promise().isCancelled()) {
+                handle.destroy();
+            } else {
+                handle.resume();
+            }
+        },
+        Qt::QueuedConnection);
+}
+
+inline void resumeOnPool(AsyncHandle handle, QThreadPool* pool, int priority) {
+    pool->start(
+        [handle]() {
+            // Locals of a cancelled coroutine may be GUI objects; free them there
+            if (handle.promise().isCancelled()) {
+                resumeOnGui(handle);
+            } else {
+                handle.resume();
+            }
+        },
+        priority);
+}
+
+}  // namespace detail
+
+// co_await resumeOnGui(): continue on the GUI thread
+struct ResumeOnGui {
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(detail::AsyncHandle handle) const { detail::resumeOnGui(handle); }
+    void await_resume() const noexcept {}
+};
+
+inline ResumeOnGui resumeOnGui() {
+    return {};
+}
+
+// co_await resumeOn(pool): continue on a pool thread. Touch no widgets until
+// the coroutine is back on the GUI thread.
+struct ResumeOn {
+    QThreadPool* pool;
+    int priority = 0;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(detail::AsyncHandle handle) const {
+        detail::resumeOnPool(handle, pool, priority);
+    }
+    void await_resume() const noexcept {}
+};
+
+inline ResumeOn resumeOn(QThreadPool* pool, int priority = 0) {
+    return {pool, priority};
+}
+
+// co_await runOn(pool, priority, f): runs f on the pool and continues on the
+// GUI thread with its result
+template <typename F>
+struct RunOn {
+    using Result = std::invoke_result_t<F>;
+
+    QThreadPool* pool;
+    int priority;
+    F function;
+    std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>> result;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(detail::AsyncHandle handle) {
+        pool->start(
+            [this, handle]() {
+                if (!handle.promise().isCancelled()) {
+                    if constexpr (std::is_void_v<Result>) {
+                        function();
+                        result.emplace(true);
+                    } else {
+                        result.emplace(function());
+                    }
+                }
+                detail::resumeOnGui(handle);
+            },
+            priority);
+    }
+    Result await_resume() {
+        if constexpr (!std::is_void_v<Result>) {
+            return std::move(*result);
+        }
+    }
+};
+
+template <typename F>
+RunOn<std::decay_t<F>> runOn(QThreadPool* pool, int priority, F&& function) {
+    return {pool, priority, std::forward<F>(function), {}};
+}
+
+// co_await delay(ms): continue on the GUI thread after ms
+struct Delay {
+    int ms;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(detail::AsyncHandle handle) const {
+        const int interval = ms;
+        auto start = [handle, interval]() {
+            QTimer::singleShot(interval, QCoreApplication::instance(), [handle]() {
+                if (handle.promise().isCancelled()) {
+                    handle.destroy();
+                } else {
+                    handle.resume();
+                }
+            });
+        };
+        // Timers need the GUI thread's event loop
+        if (detail::onGuiThread()) {
+            start();
+        } else {
+            QMetaObject::invokeMethod(QCoreApplication::instance(), start, Qt::QueuedConnection);
+        }
+    }
+    void await_resume() const noexcept {}
+};
+
+inline Delay delay(int ms) {
+    return {ms};
+}
+
+// co_await readFile(pool, path): the whole file, read on the pool; continues on
+// the GUI thread. Empty if the file cannot be opened.
+inline auto readFile(QThreadPool* pool, const QString& path) {
+    return runOn(pool, 0, [path]() -> std::optional<QByteArray> {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly)) {
+            return std::nullopt;
+        }
+        return file.readAll();
+    });
+}
+
+struct ProcessResult {
+    bool started = false;
+    int exitCode = -1;
+    QByteArray output;  // standard output
+};
+
+// co_await runProcess(program, arguments): runs the program without blocking
+// and continues on the GUI thread once it exits. A cancelled coroutine lets the
+// process finish and is then freed.
+struct RunProcess {
+    QString program;
+    QStringList arguments;
+    ProcessResult result;
+
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(detail::AsyncHandle handle) {
+        auto start = [this, handle]() {
+            auto* process = new QProcess;
+            QObject::connect(process, &QProcess::finished, process,
+                             [this, handle, process](int exitCode) {
+                                 result.exitCode = exitCode;
+                                 result.output = process->readAllStandardOutput();
+                                 process->deleteLater();
+                                 detail::resumeOnGui(handle);
+                             });
+            QObject::connect(process, &QProcess::errorOccurred, process,
+                             [this, handle, process](QProcess::ProcessError error) {
+                                 if (error == QProcess::FailedToStart) {
+                                     result.started = false;
+                                     process->deleteLater();
+                                     detail::resumeOnGui(handle);
+                                 }
+                             });
+            result.started = true;
+            process->start(program, arguments);
+        };
+        if (detail::onGuiThread()) {
+            start();
+        } else {
+            QMetaObject::invokeMethod(QCoreApplication::instance(), start, Qt::QueuedConnection);
+        }
+    }
+    ProcessResult await_resume() { return std::move(result); }
+};
+
+inline RunProcess runProcess(const QString& program, const QStringList& arguments = {}) {
+    return {program, arguments, {}};
+}
+
+}  // namespace dashboard
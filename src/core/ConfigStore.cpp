@@ -15,17 +15,100 @@
 
 #include "ConfigStore.h"
 
+#include <QSettings>
+#include <utility>
+
 namespace dashboard {
 
-ConfigStore::ConfigStore()
-    : settings_("Dashboard", "Dashboard") {}
+// Coalesces bursts such as slider drags and window resizes into one write
+static constexpr int kWriteDelayMs = 500;
+
+ConfigStore::ConfigStore(QObject* parent) : QObject(parent) {
+    QSettings settings("Dashboard", "Dashboard");
+    for (const auto& key : settings.allKeys()) {
+        values_.insert(key, settings.value(key));
+    }
+
+    // One thread keeps writes in order
+    writer_.setMaxThreadCount(1);
+    writeTimer_.setSingleShot(true);
+    writeTimer_.setInterval(kWriteDelayMs);
+    connect(&writeTimer_, &QTimer::timeout, this, &ConfigStore::writePending);
+}
+
+ConfigStore::~ConfigStore() {
+    flush();
+}
 
 QVariant ConfigStore::value(const QString& key, const QVariant& defaultValue) const {
-    return settings_.value(key, defaultValue);
+    return values_.value(key, defaultValue);
+}
+
+bool ConfigStore::setValue(const QString& key, const QVariant& value) {
+    // Values read from disk come back as strings; compare in the new value's type
+    QVariant current = values_.value(key);
+    bool changed = !current.isValid() || !current.convert(value.metaType()) || current != value;
+    return store(key, value, changed);
+}
+
+bool ConfigStore::store(const QString& key, const QVariant& value, bool changed) {
+    if (!changed && values_.contains(key)) {
+        return false;
+    }
+    values_.insert(key, value);
+    pending_.insert(key, value);
+    writeTimer_.start();
+
+    if (changed) {
+        if (!changedKeys_.contains(key)) {
+            changedKeys_.append(key);
+        }
+        if (batchDepth_ == 0) {
+            notify();
+        }
+    }
+    return changed;
+}
+
+void ConfigStore::notify() {
+    if (changedKeys_.isEmpty()) {
+        return;
+    }
+    const QStringList keys = std::exchange(changedKeys_, {});
+    for (const auto& key : keys) {
+        emit valueChanged(key);
+    }
+    emit changed(keys);
+}
+
+void ConfigStore::writePending() {
+    if (pending_.isEmpty()) {
+        return;
+    }
+    QHash<QString, QVariant> batch = std::exchange(pending_, {});
+    writer_.start([batch = std::move(batch)]() {
+        QSettings settings("Dashboard", "Dashboard");
+        for (auto it = batch.cbegin(); it != batch.cend(); ++it) {
+            settings.setValue(it.key(), it.value());
+        }
+        settings.sync();
+    });
+}
+
+void ConfigStore::flush() {
+    writeTimer_.stop();
+    writePending();
+    writer_.waitForDone();
+}
+
+ConfigStore::Batch::Batch(ConfigStore& store) : store_(store) {
+    ++store_.batchDepth_;
 }
 
-void ConfigStore::setValue(const QString& key, const QVariant& value) {
-    settings_.setValue(key, value);
+ConfigStore::Batch::~Batch() {
+    if (--store_.batchDepth_ == 0) {
+        store_.notify();
+    }
 }
 
 }  // namespace dashboard
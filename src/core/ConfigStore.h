@@ -15,21 +15,108 @@
 
 #pragma once
 
-#include <QSettings>
+#include <QHash>
+#include <QObject>
+#include <QSet>
 #include <QString>
+#include <QStringList>
+#include <QThreadPool>
+#include <QTimer>
 #include <QVariant>
 
 namespace dashboard {
 
-class ConfigStore {
+// A setting's name, type and default in one place.
+template <typename T>
+struct ConfigKey {
+    const char* name;
+    T defaultValue;
+};
+
+namespace config {
+
+inline const ConfigKey<QString> backgroundMode{"background/mode", "color"};
+inline const ConfigKey<QString> backgroundColor{"background/color", "#1a1a2a"};
+inline const ConfigKey<QString> backgroundImagePath{"background/imagePath", ""};
+inline const ConfigKey<int> backgroundOpacity{"background/opacity", 100};
+inline const ConfigKey<int> windowSizePercent{"window/sizePercent", 60};
+inline const ConfigKey<int> titleBarHeight{"window/titleBarHeight", 36};
+inline const ConfigKey<QByteArray> windowGeometry{"window/geometry", {}};
+inline const ConfigKey<bool> keepRunning{"window/keepRunning", false};
+inline const ConfigKey<QString> theme{"appearance/theme", "dark"};
+inline const ConfigKey<bool> isolatedWidgets{"widgets/isolated", false};
+inline const ConfigKey<int> pluginLoadBudgetMs{"widgets/loadBudgetMs", 100};
+inline const ConfigKey<int> canvasSizeFactor{"canvas/sizeFactor", 1};
+inline const ConfigKey<int> imageCacheMb{"canvas/imageCacheMb", 64};
+inline const ConfigKey<QString> canvasOffscreen{"canvas/offscreen", "snapshot"};
+inline const ConfigKey<QString> currentWorkspace{"workspace/current", "default"};
+inline const ConfigKey<int> stallThresholdMs{"diagnostics/stallThresholdMs", 200};
+inline const ConfigKey<int> hudHistoryMinutes{"diagnostics/hudHistoryMinutes", 10};
+inline const ConfigKey<QString> powerProfile{"power/profile", "auto"};
+inline const ConfigKey<QString> metricsSocket{"diagnostics/metricsSocket", ""};
+
+}  // namespace config
+
+// Application settings held in memory. Reads never touch disk; writes update
+// the in-memory value, notify only if it actually changed, and are written
+// to QSettings in batches on a background thread.
+class ConfigStore : public QObject {
+    Q_OBJECT
+
 public:
-    ConfigStore();
+    explicit ConfigStore(QObject* parent = nullptr);
+    ~ConfigStore() override;
+
+    template <typename T>
+    T get(const ConfigKey<T>& key) const {
+        auto it = values_.constFind(QString::fromLatin1(key.name));
+        return it == values_.cend() ? key.defaultValue : it->template value<T>();
+    }
 
+    // Returns true if the value changed.
+    template <typename T>
+    bool set(const ConfigKey<T>& key, const T& value) {
+        return store(QString::fromLatin1(key.name), QVariant::fromValue(value),
+                     get(key) != value);
+    }
+
+    // Untyped access for keys outside the schema above.
     QVariant value(const QString& key, const QVariant& defaultValue = {}) const;
-    void setValue(const QString& key, const QVariant& value);
+    bool setValue(const QString& key, const QVariant& value);
+
+    // Defers change signals until the outermost batch ends, so related keys
+    // set together are handled together.
+    class Batch {
+    public:
+        explicit Batch(ConfigStore& store);
+        ~Batch();
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+
+    private:
+        ConfigStore& store_;
+    };
+
+    // Writes pending changes and waits for them to reach disk.
+    void flush();
+
+signals:
+    void valueChanged(const QString& key);
+    // Once per set() outside a batch, or once per batch.
+    void changed(const QStringList& keys);
 
 private:
-    QSettings settings_;
+    bool store(const QString& key, const QVariant& value, bool changed);
+    void notify();
+    void writePending();
+
+    QHash<QString, QVariant> values_;
+    QHash<QString, QVariant> pending_;
+    QStringList changedKeys_;
+    int batchDepth_ = 0;
+
+    QTimer writeTimer_;
+    QThreadPool writer_;
 };
 
 }  // namespace dashboard
@@ -0,0 +1,58 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ContentPause.h"
+
+#include <QVariant>
+#include <utility>
+
+namespace dashboard {
+
+void ContentPause::pause(QWidget* content) {
+    if (content_ == content) {
+        return;
+    }
+    resume();
+    if (!content) {
+        return;
+    }
+    content_ = content;
+    for (auto* timer : content->findChildren<QTimer*>()) {
+        if (timer->isActive()) {
+            timer->stop();
+            timers_.append(timer);
+        }
+    }
+    content->setProperty(kFrozenProperty, true);
+}
+
+void ContentPause::resume() {
+    // Skips timers the widget deleted while paused
+    for (const auto& timer : std::exchange(timers_, {})) {
+        if (timer) {
+            timer->start();
+        }
+    }
+    if (content_) {
+        content_->setProperty(kFrozenProperty, false);
+    }
+    content_ = nullptr;
+}
+
+bool ContentPause::isPaused() const {
+    return content_ != nullptr;
+}
+
+}  // namespace dashboard
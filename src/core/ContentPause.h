@@ -0,0 +1,41 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QList>
+#include <QPointer>
+#include <QTimer>
+#include <QWidget>
+
+namespace dashboard {
+
+// Holds the running QTimers of a content widget while its card is frozen and
+// starts them again on resume. The content also gets kFrozenProperty, with a
+// QEvent::DynamicPropertyChange, for widgets that drive updates some other way.
+class ContentPause {
+public:
+    static constexpr const char* kFrozenProperty = "dashboardFrozen";
+
+    void pause(QWidget* content);
+    void resume();
+    bool isPaused() const;
+
+private:
+    QPointer<QWidget> content_;
+    QList<QPointer<QTimer>> timers_;
+};
+
+}  // namespace dashboard
@@ -0,0 +1,267 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "HeapAccounting.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QMutex>
+#include <QStandardPaths>
+#include <QStringList>
+#include <QTextStream>
+#include <algorithm>
+#include <utility>
+
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <unistd.h>
+
+// glibc's own implementations, which the replacements below forward to.
+// operator new/delete in libstdc++ call malloc/free, so they are accounted too.
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+void __libc_free(void* ptr);
+}
+
+namespace {
+
+struct Counters {
+    std::atomic<quint64> allocations{0};
+    std::atomic<quint64> frees{0};
+    std::atomic<quint64> allocatedBytes{0};
+    std::atomic<quint64> freedBytes{0};
+};
+
+// In front of every block: its size, owner and distance from glibc's pointer
+struct alignas(16) BlockHeader {
+    std::size_t size;
+    std::uint32_t offset;
+    std::uint32_t owner;
+};
+static_assert(sizeof(BlockHeader) == 16);
+
+Counters counters[dashboard::HeapAccounting::kMaxOwners];
+thread_local int currentOwner = 0;
+
+BlockHeader* headerOf(void* ptr) {
+    return static_cast<BlockHeader*>(ptr) - 1;
+}
+
+// alignment is a power of two
+void* allocate(std::size_t size, std::size_t alignment) {
+    const std::size_t offset = std::max(alignment, sizeof(BlockHeader));
+    if (size > SIZE_MAX - offset) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    auto* base = static_cast<char*>(offset == sizeof(BlockHeader)
+                                        ? __libc_malloc(size + offset)
+                                        : __libc_memalign(alignment, size + offset));
+    if (!base) {
+        return nullptr;
+    }
+    void* ptr = base + offset;
+    const int owner = currentOwner;
+    *headerOf(ptr) = {size, std::uint32_t(offset), std::uint32_t(owner)};
+    counters[owner].allocations.fetch_add(1, std::memory_order_relaxed);
+    counters[owner].allocatedBytes.fetch_add(size, std::memory_order_relaxed);
+    return ptr;
+}
+
+void release(void* ptr) {
+    const BlockHeader header = *headerOf(ptr);
+    counters[header.owner].frees.fetch_add(1, std::memory_order_relaxed);
+    counters[header.owner].freedBytes.fetch_add(header.size, std::memory_order_relaxed);
+    __libc_free(static_cast<char*>(ptr) - header.offset);
+}
+
+}  // namespace
+
+extern "C" {
+
+void* malloc(std::size_t size) {
+    return allocate(size, sizeof(BlockHeader));
+}
+
+void free(void* ptr) {
+    if (ptr) {
+        release(ptr);
+    }
+}
+
+void* calloc(std::size_t count, std::size_t size) {
+    std::size_t total;
+    if (__builtin_mul_overflow(count, size, &total)) {
+        errno = ENOMEM;
+        return nullptr;
+    }
+    void* ptr = allocate(total, sizeof(BlockHeader));
+    if (ptr) {
+        std::memset(ptr, 0, total);
+    }
+    return ptr;
+}
+
+void* realloc(void* ptr, std::size_t size) {
+    if (!ptr) {
+        return malloc(size);
+    }
+    if (size == 0) {
+        release(ptr);
+        return nullptr;
+    }
+    // A new block, so the bytes move to whoever grows them
+    void* grown = allocate(size, sizeof(BlockHeader));
+    if (grown) {
+        std::memcpy(grown, ptr, std::min(size, headerOf(ptr)->size));
+        release(ptr);
+    }
+    return grown;
+}
+
+void* memalign(std::size_t alignment, std::size_t size) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        errno = EINVAL;
+        return nullptr;
+    }
+    return allocate(size, alignment);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) {
+    return memalign(alignment, size);
+}
+
+int posix_memalign(void** result, std::size_t alignment, std::size_t size) {
+    if (alignment % sizeof(void*) != 0 || (alignment & (alignment - 1)) != 0) {
+        return EINVAL;
+    }
+    void* ptr = allocate(size, alignment);
+    if (!ptr) {
+        return ENOMEM;
+    }
+    *result = ptr;
+    return 0;
+}
+
+void* valloc(std::size_t size) {
+    return allocate(size, std::size_t(sysconf(_SC_PAGESIZE)));
+}
+
+void* pvalloc(std::size_t size) {
+    const auto page = std::size_t(sysconf(_SC_PAGESIZE));
+    return allocate((size + page - 1) & ~(page - 1), page);
+}
+
+std::size_t malloc_usable_size(void* ptr) {
+    return ptr ? headerOf(ptr)->size : 0;
+}
+
+}  // extern "C"
+#endif
+
+namespace dashboard {
+
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+static QMutex s_namesMutex;
+static QStringList s_names{QStringLiteral("<host>")};
+#endif
+
+int HeapAccounting::ownerFor(const QString& pluginName) {
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    QMutexLocker lock(&s_namesMutex);
+    int owner = int(s_names.indexOf(pluginName));
+    if (owner < 0 && s_names.size() < kMaxOwners) {
+        owner = int(s_names.size());
+        s_names.append(pluginName);
+    }
+    return qMax(owner, 0);
+#else
+    Q_UNUSED(pluginName);
+    return 0;
+#endif
+}
+
+int HeapAccounting::setCurrentOwner(int owner) {
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    return std::exchange(currentOwner, owner);
+#else
+    Q_UNUSED(owner);
+    return 0;
+#endif
+}
+
+QList<HeapAccounting::Owner> HeapAccounting::owners() {
+    QList<Owner> result;
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    QMutexLocker lock(&s_namesMutex);
+    for (int i = 0; i < s_names.size(); ++i) {
+        const Counters& c = counters[i];
+        Owner owner;
+        owner.name = s_names.at(i);
+        owner.allocations = c.allocations.load(std::memory_order_relaxed);
+        owner.frees = c.frees.load(std::memory_order_relaxed);
+        owner.allocatedBytes = c.allocatedBytes.load(std::memory_order_relaxed);
+        owner.liveBytes = qint64(owner.allocatedBytes - c.freedBytes.load(std::memory_order_relaxed));
+        result.append(owner);
+    }
+#endif
+    return result;
+}
+
+QString HeapAccounting::dumpFilePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation)
+           + "/diagnostics/heap.txt";
+}
+
+bool HeapAccounting::dump() {
+    if (!kEnabled) {
+        return false;
+    }
+    QList<Owner> sorted = owners();
+    std::sort(sorted.begin(), sorted.end(),
+              [](const Owner& a, const Owner& b) { return a.liveBytes > b.liveBytes; });
+
+    const QString path = dumpFilePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&file);
+    out << "# " << QDateTime::currentDateTime().toString(Qt::ISODateWithMs) << '\n';
+    out << QString("%1 %2 %3 %4 %5\n")
+               .arg("owner", -32)
+               .arg("live_bytes", 14)
+               .arg("allocations", 14)
+               .arg("frees", 14)
+               .arg("allocated_bytes", 16);
+    for (const Owner& owner : sorted) {
+        out << QString("%1 %2 %3 %4 %5\n")
+                   .arg(owner.name, -32)
+                   .arg(owner.liveBytes, 14)
+                   .arg(owner.allocations, 14)
+                   .arg(owner.frees, 14)
+                   .arg(owner.allocatedBytes, 16);
+    }
+    return true;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,61 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QList>
+#include <QString>
+#include <QtGlobal>
+
+namespace dashboard {
+
+// Per-plugin heap accounting for finding leaks, compiled in with
+// -DDASHBOARD_HEAP_ACCOUNTING=ON. That build replaces malloc and friends
+// (operator new/delete go through them) with versions that tag each block with
+// the owner current on the allocating thread: the plugin whose code a
+// PluginScope is running, or the host. Frees are charged to the block's owner,
+// so bytes a plugin allocated stay on its account until they are released,
+// whoever releases them. Without the option nothing is replaced and every
+// function here is a no-op.
+class HeapAccounting {
+public:
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    static constexpr bool kEnabled = true;
+#else
+    static constexpr bool kEnabled = false;
+#endif
+    // Owner 0 is the host; plugins past the table size are charged to it too
+    static constexpr int kMaxOwners = 256;
+
+    struct Owner {
+        QString name;
+        quint64 allocations = 0;
+        quint64 frees = 0;
+        quint64 allocatedBytes = 0;
+        qint64 liveBytes = 0;
+    };
+
+    // Registers a plugin name on first use; call outside allocator code.
+    static int ownerFor(const QString& pluginName);
+    // Sets the owner of the calling thread's allocations, returning the previous one.
+    static int setCurrentOwner(int owner);
+    static QList<Owner> owners();
+
+    // <AppConfigLocation>/diagnostics/heap.txt
+    static QString dumpFilePath();
+    static bool dump();
+};
+
+}  // namespace dashboard
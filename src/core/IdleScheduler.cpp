@@ -0,0 +1,224 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "IdleScheduler.h"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <qlogging.h>
+#include <algorithm>
+
+namespace dashboard {
+
+static constexpr int kSliceIntervalMs = 50;
+static constexpr int kSliceBudgetMs = 4;
+// No user input for this long before idle work runs
+static constexpr int kInputQuietMs = 250;
+// A slice timer this late means the event loop is busy
+static constexpr int kBusyLatenessMs = 20;
+// Tasks older than this run even while the user is interacting
+static constexpr int kMaxDelayMs = 5000;
+// flush() gives up on tasks that still have work after this long
+static constexpr int kFlushLimitMs = 2000;
+
+static IdleScheduler* s_instance = nullptr;
+
+IdleScheduler::IdleScheduler(QObject* parent) : QObject(parent) {
+    s_instance = this;
+    clock_.start();
+    sliceTimer_.setInterval(kSliceIntervalMs);
+    connect(&sliceTimer_, &QTimer::timeout, this, &IdleScheduler::runSlice);
+}
+
+IdleScheduler::~IdleScheduler() {
+    if (s_instance == this) {
+        s_instance = nullptr;
+    }
+}
+
+IdleScheduler* IdleScheduler::instance() {
+    return s_instance;
+}
+
+int IdleScheduler::post(const QString& name, Step step, Priority priority, QObject* context) {
+    if (!name.isEmpty()) {
+        for (auto& task : tasks_) {
+            if (task.name == name) {
+                task.generation = nextGeneration_++;
+                task.step = std::move(step);
+                task.priority = priority;
+                task.context = context;
+                task.hasContext = context != nullptr;
+                return task.id;
+            }
+        }
+    }
+    Task task;
+    task.id = nextId_++;
+    task.generation = nextGeneration_++;
+    task.name = name;
+    task.step = std::move(step);
+    task.priority = priority;
+    task.context = context;
+    task.hasContext = context != nullptr;
+    task.postedMs = clock_.elapsed();
+    tasks_.push_back(std::move(task));
+    updateTimer();
+    return tasks_.back().id;
+}
+
+void IdleScheduler::cancel(int id) {
+    std::erase_if(tasks_, [id](const Task& task) { return task.id == id; });
+    updateTimer();
+}
+
+bool IdleScheduler::isPending(int id) const {
+    return std::any_of(tasks_.begin(), tasks_.end(),
+                       [id](const Task& task) { return task.id == id; });
+}
+
+void IdleScheduler::flush() {
+    QElapsedTimer limit;
+    limit.start();
+    for (int index = pick(false, 0); index >= 0; index = pick(false, 0)) {
+        if (limit.elapsed() >= kFlushLimitMs) {
+            qWarning() << "Idle tasks still unfinished after" << kFlushLimitMs << "ms; dropping"
+                       << tasks_.size();
+            tasks_.clear();
+            break;
+        }
+        runStep(index, false);
+    }
+    updateTimer();
+}
+
+IdleScheduler::Stats IdleScheduler::stats() const {
+    Stats stats = stats_;
+    stats.pending = int(tasks_.size());
+    return stats;
+}
+
+int IdleScheduler::schedule(QObject* receiver, const QByteArray& method, int priority) {
+    if (!receiver) {
+        return 0;
+    }
+    auto step = [receiver, method]() {
+        bool more = false;
+        if (!QMetaObject::invokeMethod(receiver, method.constData(), Qt::DirectConnection,
+                                       Q_RETURN_ARG(bool, more))) {
+            qWarning() << "Idle task" << method << "cannot be invoked on" << receiver;
+        }
+        return more;
+    };
+    return post({}, std::move(step), static_cast<Priority>(qBound(0, priority, 2)), receiver);
+}
+
+void IdleScheduler::unschedule(int id) {
+    cancel(id);
+}
+
+bool IdleScheduler::eventFilter(QObject* watched, QEvent* event) {
+    switch (event->type()) {
+        case QEvent::MouseButtonPress:
+        case QEvent::MouseButtonRelease:
+        case QEvent::MouseMove:
+        case QEvent::Wheel:
+        case QEvent::KeyPress:
+        case QEvent::KeyRelease:
+        case QEvent::TouchBegin:
+        case QEvent::TouchUpdate:
+            lastInputMs_ = clock_.elapsed();
+            break;
+        default:
+            break;
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void IdleScheduler::runSlice() {
+    const qint64 now = clock_.elapsed();
+    const qint64 lateness = now - lastTickMs_ - kSliceIntervalMs;
+    lastTickMs_ = now;
+    const bool idle = lateness < kBusyLatenessMs && now - lastInputMs_ >= kInputQuietMs;
+
+    QElapsedTimer budget;
+    budget.start();
+    // Always at least one step, so a step longer than the budget still progresses
+    do {
+        const int index = pick(!idle, now);
+        if (index < 0) {
+            break;
+        }
+        runStep(index, idle);
+    } while (budget.elapsed() < kSliceBudgetMs);
+    updateTimer();
+}
+
+int IdleScheduler::pick(bool overdueOnly, qint64 nowMs) {
+    // Tasks whose context is gone are cancelled
+    std::erase_if(tasks_, [](const Task& task) { return task.hasContext && !task.context; });
+    int best = -1;
+    for (int i = 0; i < int(tasks_.size()); ++i) {
+        const Task& task = tasks_[i];
+        if (overdueOnly && nowMs - task.postedMs < kMaxDelayMs) {
+            continue;
+        }
+        // Ties keep the earlier, i.e. older, task
+        if (best < 0 || task.priority < tasks_[best].priority) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+void IdleScheduler::runStep(int index, bool idle) {
+    const int id = tasks_[index].id;
+    const quint64 generation = tasks_[index].generation;
+    // The step may post or cancel tasks, so it runs on a copy
+    const Step step = tasks_[index].step;
+    QElapsedTimer timer;
+    timer.start();
+    const bool more = step();
+    const qint64 ns = timer.nsecsElapsed();
+    if (idle) {
+        stats_.idleNs += ns;
+        ++stats_.idleSteps;
+    } else {
+        stats_.criticalNs += ns;
+        ++stats_.criticalSteps;
+    }
+    // A step that re-posted its own name was replaced under the same id; the
+    // replacement stays
+    if (!more) {
+        std::erase_if(tasks_, [id, generation](const Task& task) {
+            return task.id == id && task.generation == generation;
+        });
+        updateTimer();
+    }
+}
+
+void IdleScheduler::updateTimer() {
+    if (tasks_.empty()) {
+        sliceTimer_.stop();
+        QCoreApplication::instance()->removeEventFilter(this);
+    } else if (!sliceTimer_.isActive()) {
+        // Input is only watched while there is work waiting for a quiet moment
+        QCoreApplication::instance()->installEventFilter(this);
+        lastTickMs_ = clock_.elapsed();
+        sliceTimer_.start();
+    }
+}
+
+}  // namespace dashboard
@@ -0,0 +1,107 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+#include <functional>
+#include <vector>
+
+namespace dashboard {
+
+// Runs low-priority host work in short slices while the event loop is idle:
+// no input for a moment and the slice timer not running late. Tasks run one
+// step at a time, highest priority first and oldest first within a priority,
+// until the slice budget is spent. A task that waited too long runs anyway,
+// and flush() runs everything at once; both count as critical-path work.
+//
+// Widgets find the scheduler as the dynamic property kSchedulerProperty
+// (a QObject*) on their content widget and call the invokable schedule() and
+// unschedule(), so plugins need no host headers.
+class IdleScheduler : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr const char* kSchedulerProperty = "dashboardIdleScheduler";
+
+    enum class Priority : int { High, Normal, Low };
+
+    // One step of work; returns true while there is more to do
+    using Step = std::function<bool()>;
+
+    struct Stats {
+        qint64 idleNs = 0;
+        qint64 criticalNs = 0;
+        quint64 idleSteps = 0;
+        quint64 criticalSteps = 0;
+        int pending = 0;
+    };
+
+    explicit IdleScheduler(QObject* parent = nullptr);
+    ~IdleScheduler() override;
+
+    static IdleScheduler* instance();
+
+    // A pending task with the same non-empty name is replaced and keeps its id
+    // and place. The task is dropped when context is destroyed.
+    int post(const QString& name, Step step, Priority priority = Priority::Normal,
+             QObject* context = nullptr);
+    void cancel(int id);
+    bool isPending(int id) const;
+    // Runs the pending tasks to completion now, e.g. before quitting
+    void flush();
+    Stats stats() const;
+
+    // Plugin entry points: receiver's method is invoked with no arguments and
+    // returns bool like Step. priority is 0 (high) to 2 (low).
+    Q_INVOKABLE int schedule(QObject* receiver, const QByteArray& method, int priority = 1);
+    Q_INVOKABLE void unschedule(int id);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    struct Task {
+        int id = 0;
+        quint64 generation = 0;  // new for every post(), also when replacing
+        QString name;
+        Step step;
+        Priority priority = Priority::Normal;
+        QPointer<QObject> context;
+        bool hasContext = false;
+        qint64 postedMs = 0;
+    };
+
+    void runSlice();
+    int pick(bool overdueOnly, qint64 nowMs);
+    void runStep(int index, bool idle);
+    void updateTimer();
+
+    std::vector<Task> tasks_;
+    int nextId_ = 1;
+    quint64 nextGeneration_ = 1;
+    QTimer sliceTimer_;
+    QElapsedTimer clock_;
+    qint64 lastTickMs_ = 0;
+    qint64 lastInputMs_ = -1000000;
+    Stats stats_;
+};
+
+}  // namespace dashboard
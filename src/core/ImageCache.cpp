@@ -0,0 +1,285 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ImageCache.h"
+
+#include "TaskExecutor.h"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QDirIterator>
+#include <QFileInfo>
+#include <QImageReader>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QTimer>
+#include <QUrl>
+#include <algorithm>
+#include <utility>
+
+namespace dashboard {
+
+static constexpr int kDownloadTimeoutMs = 15000;
+// Downloads beyond this are removed at startup, oldest first
+static constexpr qint64 kDiskBudgetBytes = 64ll * 1024 * 1024;
+// An image larger than the memory budget is held this long for its requester
+static constexpr int kOversizedHoldMs = 5000;
+
+static ImageCache* s_instance = nullptr;
+
+namespace {
+
+// co_await ReplyFinished{reply}: continue on the GUI thread once it finished
+struct ReplyFinished {
+    QNetworkReply* reply;
+
+    bool await_ready() const { return reply->isFinished(); }
+    void await_suspend(detail::AsyncHandle handle) const {
+        QObject::connect(reply, &QNetworkReply::finished, reply,
+                         [handle]() { detail::resumeOnGui(handle); });
+    }
+    void await_resume() const noexcept {}
+};
+
+void pruneDisk(const QString& dirPath) {
+    QList<QFileInfo> files;
+    qint64 total = 0;
+    QDirIterator it(dirPath, QDir::Files);
+    while (it.hasNext()) {
+        files.append(QFileInfo(it.next()));
+        total += files.last().size();
+    }
+    std::sort(files.begin(), files.end(), [](const QFileInfo& a, const QFileInfo& b) {
+        return a.lastModified() < b.lastModified();
+    });
+    for (const QFileInfo& file : files) {
+        if (total <= kDiskBudgetBytes) {
+            break;
+        }
+        total -= file.size();
+        QFile::remove(file.filePath());
+    }
+}
+
+}  // namespace
+
+ImageCache::ImageCache(QObject* parent) : QObject(parent) {
+    s_instance = this;
+    setBudgetBytes(qint64(kDefaultBudgetMb) * 1024 * 1024);
+    if (TaskExecutor* executor = TaskExecutor::instance()) {
+        executor->submit(TaskExecutor::Lane::Background, [dir = diskPath()]() { pruneDisk(dir); });
+    }
+}
+
+ImageCache::~ImageCache() {
+    if (s_instance == this) {
+        s_instance = nullptr;
+    }
+}
+
+ImageCache* ImageCache::instance() {
+    return s_instance;
+}
+
+QString ImageCache::diskPath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/images";
+}
+
+void ImageCache::setBudgetBytes(qint64 bytes) {
+    const qsizetype before = pixmaps_.size();
+    pixmaps_.setMaxCost(bytes);
+    stats_.evictions += before - pixmaps_.size();
+}
+
+QString ImageCache::keyFor(const QString& source, const QSize& size, qreal dpr,
+                           Qt::AspectRatioMode mode) {
+    return QString("%1|%2x%3@%4|%5")
+        .arg(source)
+        .arg(size.width())
+        .arg(size.height())
+        .arg(dpr)
+        .arg(int(mode));
+}
+
+bool ImageCache::isRemote(const QString& source) {
+    return source.startsWith("http://") || source.startsWith("https://");
+}
+
+QString ImageCache::diskFile(const QString& url) {
+    const QByteArray name = QCryptographicHash::hash(url.toUtf8(), QCryptographicHash::Sha1).toHex();
+    return diskPath() + "/" + QString::fromLatin1(name);
+}
+
+QPixmap ImageCache::find(const QString& source, const QSize& size, qreal dpr,
+                         Qt::AspectRatioMode mode) {
+    const QString key = keyFor(source, size, dpr, mode);
+    if (QPixmap* pixmap = pixmaps_.object(key)) {
+        ++stats_.hits;
+        return *pixmap;
+    }
+    if (auto it = oversized_.constFind(key); it != oversized_.cend()) {
+        ++stats_.hits;
+        return *it;
+    }
+    ++stats_.misses;
+    return {};
+}
+
+void ImageCache::request(const QString& source, const QSize& size, qreal dpr,
+                         Qt::AspectRatioMode mode) {
+    const QString key = keyFor(source, size, dpr, mode);
+    if (source.isEmpty() || pixmaps_.contains(key) || oversized_.contains(key)
+        || loading_.contains(key) || failed_.contains(key)) {
+        return;
+    }
+    loading_.insert(key);
+    const Request request{key, source, size, dpr, mode};
+    if (isRemote(source)) {
+        // One download per URL, however many sizes are waiting for it
+        QList<Request>& waiting = downloads_[source];
+        waiting.append(request);
+        if (waiting.size() == 1) {
+            fetch(lifetime_, source);
+        }
+        return;
+    }
+    QString path = source;
+    if (path.startsWith("file:")) {
+        path = QUrl(source).toLocalFile();
+    } else if (path.startsWith("qrc:")) {
+        path = path.mid(3);
+    }
+    load(lifetime_, request, path);
+}
+
+QPixmap ImageCache::pixmap(const QString& source, const QSize& size, qreal dpr,
+                           Qt::AspectRatioMode mode) {
+    QPixmap result = find(source, size, dpr, mode);
+    if (result.isNull()) {
+        request(source, size, dpr, mode);
+    }
+    return result;
+}
+
+ImageCache::Stats ImageCache::stats() const {
+    Stats stats = stats_;
+    stats.bytes = pixmaps_.totalCost();
+    stats.images = int(pixmaps_.size() + oversized_.size());
+    for (const QPixmap& pixmap : oversized_) {
+        stats.bytes += qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+    }
+    return stats;
+}
+
+QImage ImageCache::decode(const QString& path, const QSize& deviceSize, Qt::AspectRatioMode mode) {
+    QImageReader reader(path);
+    reader.setAutoTransform(true);
+    if (!deviceSize.isEmpty() && reader.size().isValid()) {
+        reader.setScaledSize(reader.size().scaled(deviceSize, mode));
+    }
+    QImage image = reader.read();
+    if (image.isNull()) {
+        return image;
+    }
+    // The format QPixmap uses, so the GUI thread does not convert it
+    return image.convertToFormat(image.hasAlphaChannel() ? QImage::Format_ARGB32_Premultiplied
+                                                         : QImage::Format_RGB32);
+}
+
+Async ImageCache::fetch(Lifetime lifetime, QString url) {
+    const QString file = diskFile(url);
+    bool stored = QFileInfo::exists(file);
+    if (!stored) {
+        QNetworkReply* reply = network()->get(QNetworkRequest(QUrl(url)));
+        co_await ReplyFinished{reply};
+        reply->deleteLater();
+        if (reply->error() == QNetworkReply::NoError) {
+            auto write = [file, data = reply->readAll()]() {
+                QDir().mkpath(QFileInfo(file).absolutePath());
+                QSaveFile out(file);
+                return out.open(QIODevice::WriteOnly) && out.write(data) == data.size()
+                       && out.commit();
+            };
+            if (TaskExecutor* executor = TaskExecutor::instance()) {
+                stored = co_await executor->run(TaskExecutor::Lane::Background, write);
+            } else {
+                stored = write();
+            }
+        } else {
+            qWarning() << "Image cache: download failed:" << url << reply->errorString();
+        }
+    }
+    for (const Request& request : downloads_.take(url)) {
+        if (stored) {
+            load(lifetime, request, file);
+        } else {
+            loading_.remove(request.key);
+            failed_.insert(request.key);
+        }
+    }
+}
+
+Async ImageCache::load(Lifetime lifetime, Request request, QString path) {
+    const QSize deviceSize = (QSizeF(request.size) * request.dpr).toSize();
+    QImage image;
+    if (TaskExecutor* executor = TaskExecutor::instance()) {
+        image = co_await executor->run(TaskExecutor::Lane::Normal,
+                                       [path, deviceSize, mode = request.mode]() {
+                                           return decode(path, deviceSize, mode);
+                                       });
+    } else {
+        image = decode(path, deviceSize, request.mode);
+    }
+    loading_.remove(request.key);
+    if (image.isNull()) {
+        qWarning() << "Image cache: cannot decode" << request.source;
+        failed_.insert(request.key);
+        co_return;
+    }
+
+    const qsizetype cost = image.sizeInBytes();
+    QPixmap pixmap = QPixmap::fromImage(std::move(image));
+    pixmap.setDevicePixelRatio(request.dpr);
+    if (cost > pixmaps_.maxCost()) {
+        // Would evict everything and then be dropped itself. Held briefly for the
+        // requester, which keeps its copy and decodes again if it needs it later.
+        oversized_.insert(request.key, pixmap);
+        QTimer::singleShot(kOversizedHoldMs, this, [this, key = request.key,
+                                                    id = pixmap.cacheKey()]() {
+            auto it = oversized_.find(key);
+            if (it != oversized_.end() && it->cacheKey() == id) {
+                oversized_.erase(it);
+            }
+        });
+    } else {
+        const qsizetype before = pixmaps_.size();
+        pixmaps_.insert(request.key, new QPixmap(pixmap), cost);
+        stats_.evictions += before + 1 - pixmaps_.size();
+    }
+    emit imageReady(request.source, request.size, request.dpr);
+}
+
+QNetworkAccessManager* ImageCache::network() {
+    if (!network_) {
+        network_ = new QNetworkAccessManager(this);
+        network_->setTransferTimeout(kDownloadTimeoutMs);
+    }
+    return network_;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,118 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "core/Async.h"
+
+#include <QCache>
+#include <QHash>
+#include <QImage>
+#include <QList>
+#include <QObject>
+#include <QPixmap>
+#include <QSet>
+#include <QSize>
+#include <QString>
+
+class QNetworkAccessManager;
+
+namespace dashboard {
+
+// Decoded images shared by the canvas and all widgets, keyed by source,
+// target size, device pixel ratio and aspect mode, so ten cards showing the
+// same favicon hold one copy. Sources are file paths, qrc paths or http(s)
+// URLs. Decoding runs on the host pool (TaskExecutor) at the target size;
+// downloads are kept on disk under <CacheLocation>/images. Decoded pixmaps
+// are evicted least recently used first once the memory budget is spent; an
+// image larger than the whole budget is held only a few seconds for its
+// requester to pick up.
+//
+// Widgets find the cache as the dynamic property kCacheProperty (a QObject*)
+// on their content widget, call the invokable pixmap() from paint code and
+// repaint on imageReady.
+class ImageCache : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr const char* kCacheProperty = "dashboardImageCache";
+    static constexpr int kDefaultBudgetMb = 64;
+
+    struct Stats {
+        quint64 hits = 0;
+        quint64 misses = 0;
+        quint64 evictions = 0;
+        qint64 bytes = 0;
+        int images = 0;
+    };
+
+    explicit ImageCache(QObject* parent = nullptr);
+    ~ImageCache() override;
+
+    static ImageCache* instance();
+    static QString diskPath();
+
+    void setBudgetBytes(qint64 bytes);
+
+    // The cached image, or a null pixmap. size is in logical pixels and the
+    // image fits it per mode; an empty size means the image's own size.
+    Q_INVOKABLE QPixmap find(const QString& source, const QSize& size = {}, qreal dpr = 1.0,
+                             Qt::AspectRatioMode mode = Qt::KeepAspectRatio);
+    // Loads the image unless it is cached or already loading; imageReady follows.
+    // A source that failed to load is not retried until the next start.
+    Q_INVOKABLE void request(const QString& source, const QSize& size = {}, qreal dpr = 1.0,
+                             Qt::AspectRatioMode mode = Qt::KeepAspectRatio);
+    // find(), and request() on a miss
+    Q_INVOKABLE QPixmap pixmap(const QString& source, const QSize& size = {}, qreal dpr = 1.0,
+                               Qt::AspectRatioMode mode = Qt::KeepAspectRatio);
+
+    Stats stats() const;
+
+    // Reads and scales an image file on the calling thread, scaling while
+    // decoding where the format supports it. deviceSize empty: natural size.
+    static QImage decode(const QString& path, const QSize& deviceSize, Qt::AspectRatioMode mode);
+
+signals:
+    void imageReady(const QString& source, const QSize& size, qreal dpr);
+
+private:
+    struct Request {
+        QString key;
+        QString source;
+        QSize size;
+        qreal dpr;
+        Qt::AspectRatioMode mode;
+    };
+
+    static QString keyFor(const QString& source, const QSize& size, qreal dpr,
+                          Qt::AspectRatioMode mode);
+    static bool isRemote(const QString& source);
+    static QString diskFile(const QString& url);
+
+    Async fetch(Lifetime lifetime, QString url);
+    Async load(Lifetime lifetime, Request request, QString path);
+    QNetworkAccessManager* network();
+
+    QCache<QString, QPixmap> pixmaps_;  // cost in bytes
+    QSet<QString> loading_;
+    QSet<QString> failed_;
+    QHash<QString, QPixmap> oversized_;  // larger than the budget; expire after a few seconds
+    QHash<QString, QList<Request>> downloads_;  // url -> requests waiting for it
+    QNetworkAccessManager* network_ = nullptr;
+    Stats stats_;
+    Lifetime lifetime_{this};
+};
+
+}  // namespace dashboard
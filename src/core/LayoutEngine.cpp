@@ -15,9 +15,12 @@
 
 #include "LayoutEngine.h"
 
+#include "Metrics.h"
+
 #include <QDir>
 #include <QFile>
 #include <QJsonDocument>
+#include <QRegularExpression>
 #include <QStandardPaths>
 
 namespace dashboard {
@@ -27,14 +30,20 @@ LayoutEngine::LayoutEngine() = default;
 QString LayoutEngine::generateInstanceId(const QString& pluginName) const {
     int maxNum = 0;
     QString prefix = pluginName + "_";
-    for (auto it = layouts_.cbegin(); it != layouts_.cend(); ++it) {
-        if (it.key().startsWith(prefix)) {
+    auto consider = [&](const QString& id) {
+        if (id.startsWith(prefix)) {
             bool ok = false;
-            int num = it.key().mid(prefix.length()).toInt(&ok);
+            int num = id.mid(prefix.length()).toInt(&ok);
             if (ok && num > maxNum) {
                 maxNum = num;
             }
         }
+    };
+    for (auto it = layouts_.cbegin(); it != layouts_.cend(); ++it) {
+        consider(it.key());
+    }
+    for (const auto& id : reservedIds_) {
+        consider(id);
     }
     return prefix + QString::number(maxNum + 1);
 }
@@ -57,6 +66,14 @@ void LayoutEngine::updateSize(const QString& instanceId, const QSize& size) {
     }
 }
 
+void LayoutEngine::updateGeometry(const QString& instanceId, const QRect& geometry) {
+    auto it = layouts_.find(instanceId);
+    if (it != layouts_.end()) {
+        it->position = geometry.topLeft();
+        it->size = geometry.size();
+    }
+}
+
 void LayoutEngine::removeWidget(const QString& instanceId) {
     layouts_.remove(instanceId);
 }
@@ -103,7 +120,7 @@ void LayoutEngine::saveToFile(const QString& path) const {
     QFile file(path);
     if (file.open(QIODevice::WriteOnly)) {
         QJsonDocument doc(serialize());
-        file.write(doc.toJson());
+        metrics::recordWrite(metrics::Store::Layout, file.write(doc.toJson()));
     }
 }
 
@@ -115,10 +132,64 @@ void LayoutEngine::loadFromFile(const QString& path) {
     }
 }
 
-QString LayoutEngine::layoutFilePath() {
+void LayoutEngine::loadWorkspace(const QString& workspace) {
+    layouts_.clear();
+    loadFromFile(layoutFilePath(workspace));
+    reserveOtherWorkspaces(workspace);
+}
+
+void LayoutEngine::reserveOtherWorkspaces(const QString& workspace) {
+    reservedIds_.clear();
+    for (const auto& name : workspaceNames()) {
+        if (name == workspace) {
+            continue;
+        }
+        for (const auto& layout : layoutsIn(name)) {
+            reservedIds_.insert(layout.instanceId);
+        }
+    }
+}
+
+bool LayoutEngine::contains(const QString& instanceId) const {
+    return layouts_.contains(instanceId);
+}
+
+bool LayoutEngine::isUsedElsewhere(const QString& instanceId) const {
+    return reservedIds_.contains(instanceId);
+}
+
+QString LayoutEngine::layoutFilePath(const QString& workspace) {
     QString configDir =
         QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation) + "/layouts";
-    return configDir + "/default.json";
+    return configDir + "/" + workspace + ".json";
+}
+
+QString LayoutEngine::defaultWorkspace() {
+    return QStringLiteral("default");
+}
+
+QStringList LayoutEngine::workspaceNames() {
+    QDir dir(QFileInfo(layoutFilePath()).absolutePath());
+    QStringList names;
+    for (const auto& info : dir.entryInfoList({"*.json"}, QDir::Files, QDir::Name)) {
+        names.append(info.completeBaseName());
+    }
+    // The default workspace always exists, even before its first save
+    names.removeAll(defaultWorkspace());
+    names.prepend(defaultWorkspace());
+    return names;
+}
+
+QList<WidgetLayout> LayoutEngine::layoutsIn(const QString& workspace) {
+    LayoutEngine engine;
+    engine.loadFromFile(layoutFilePath(workspace));
+    return engine.allLayouts();
+}
+
+bool LayoutEngine::isValidWorkspaceName(const QString& name) {
+    // Names double as file names
+    static const QRegularExpression pattern("^[A-Za-z0-9][A-Za-z0-9 _-]{0,31}$");
+    return pattern.match(name).hasMatch();
 }
 
 }  // namespace dashboard
@@ -19,8 +19,11 @@
 #include <QJsonObject>
 #include <QMap>
 #include <QPoint>
+#include <QRect>
+#include <QSet>
 #include <QSize>
 #include <QString>
+#include <QStringList>
 
 namespace dashboard {
 
@@ -38,6 +41,7 @@ public:
     QString addWidget(const QString& pluginName, const QPoint& pos, const QSize& size);
     void updatePosition(const QString& instanceId, const QPoint& pos);
     void updateSize(const QString& instanceId, const QSize& size);
+    void updateGeometry(const QString& instanceId, const QRect& geometry);
     void removeWidget(const QString& instanceId);
     WidgetLayout widgetLayout(const QString& instanceId) const;
     QList<WidgetLayout> allLayouts() const;
@@ -45,7 +49,18 @@ public:
     void saveToFile(const QString& path) const;
     void loadFromFile(const QString& path);
 
-    static QString layoutFilePath();
+    // Loads a workspace's layout and reserves the instance IDs used by all
+    // other workspaces, so a new instance never collides with an inactive one.
+    void loadWorkspace(const QString& workspace);
+    void reserveOtherWorkspaces(const QString& workspace);
+    bool contains(const QString& instanceId) const;
+    bool isUsedElsewhere(const QString& instanceId) const;
+
+    static QString layoutFilePath(const QString& workspace = defaultWorkspace());
+    static QString defaultWorkspace();
+    static QStringList workspaceNames();
+    static QList<WidgetLayout> layoutsIn(const QString& workspace);
+    static bool isValidWorkspaceName(const QString& name);
 
 private:
     QString generateInstanceId(const QString& pluginName) const;
@@ -54,6 +69,7 @@ private:
     void deserialize(const QJsonArray& data);
 
     QMap<QString, WidgetLayout> layouts_;
+    QSet<QString> reservedIds_;
 };
 
 }  // namespace dashboard
@@ -0,0 +1,54 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QtGlobal>
+#include <atomic>
+
+namespace dashboard {
+
+// Process-wide counters for code paths that may run on any thread. Relaxed
+// atomics only: they are bumped on hot paths and read by the MetricsServer.
+namespace metrics {
+
+enum class Store : int {
+    Layout,
+    WidgetData,
+};
+
+inline constexpr int kStoreKinds = 2;
+
+struct StoreCounters {
+    std::atomic<quint64> writes{0};
+    std::atomic<quint64> bytes{0};
+};
+
+inline StoreCounters storeCounters[kStoreKinds];
+
+inline void recordWrite(Store store, qint64 bytes) {
+    auto& counters = storeCounters[int(store)];
+    counters.writes.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes.fetch_add(quint64(qMax<qint64>(bytes, 0)), std::memory_order_relaxed);
+}
+
+// The latest layout restore (startup or workspace switch), in ms since it
+// started; -1 until one has got that far
+inline std::atomic<qint64> restoreFirstPaintMs{-1};
+inline std::atomic<qint64> restoreCompleteMs{-1};
+
+}  // namespace metrics
+
+}  // namespace dashboard
@@ -0,0 +1,298 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PerfMonitor.h"
+
+#include "HeapAccounting.h"
+#include "StallWatchdog.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QStandardPaths>
+#include <QTextStream>
+#include <qlogging.h>
+
+namespace dashboard {
+
+static constexpr int kHeartbeatMs = 50;
+static constexpr qint64 kMaxLogBytes = 1024 * 1024;
+
+static PerfMonitor* s_instance = nullptr;
+
+const char* pluginCallName(PluginCall call) {
+    switch (call) {
+        case PluginCall::CreateWidget: return "createWidget";
+        case PluginCall::Deserialize:  return "deserialize";
+        case PluginCall::Serialize:    return "serialize";
+        case PluginCall::Paint:        return "paint";
+        case PluginCall::Event:        return "event";
+    }
+    return "unknown";
+}
+
+PerfMonitor::PerfMonitor(int stallThresholdMs, QObject* parent)
+    : QObject(parent), stallThresholdMs_(stallThresholdMs) {
+    s_instance = this;
+    clock_.start();
+    lastBeatNs_ = clock_.nsecsElapsed();
+
+    connect(&heartbeat_, &QTimer::timeout, this, &PerfMonitor::onHeartbeat);
+    heartbeat_.start(kHeartbeatMs);
+
+    if (stallThresholdMs_ > 0) {
+        watchdog_ = std::make_unique<StallWatchdog>(*this);
+        watchdog_->start(QThread::LowPriority);
+    }
+}
+
+PerfMonitor::~PerfMonitor() {
+    if (watchdog_) {
+        watchdog_->requestInterruption();
+        watchdog_->wait();
+    }
+    logHistogram();
+    s_instance = nullptr;
+}
+
+PerfMonitor* PerfMonitor::instance() {
+    return s_instance;
+}
+
+QString PerfMonitor::logFilePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::AppConfigLocation)
+           + "/diagnostics/stalls.log";
+}
+
+void PerfMonitor::setLogEnabled(bool enabled) {
+    logEnabled_.store(enabled, std::memory_order_relaxed);
+}
+
+int PerfMonitor::stallThresholdMs() const {
+    return stallThresholdMs_;
+}
+
+InstanceStats* PerfMonitor::stats(const QString& pluginName, const QString& instanceId) {
+    const QString key = pluginName + '/' + instanceId;
+    auto it = stats_.find(key);
+    if (it == stats_.end()) {
+        auto entry = std::make_shared<InstanceStats>();
+        entry->pluginName = pluginName;
+        entry->instanceId = instanceId;
+        entry->heapOwner = HeapAccounting::ownerFor(pluginName);
+        it = stats_.insert(key, entry);
+    }
+    return it.value().get();
+}
+
+InstanceStats* PerfMonitor::stats(QObject* frame, const QString& pluginName,
+                                  const QString& instanceId) {
+    auto it = frameStats_.find(frame);
+    if (it != frameStats_.end() && it.value()->instanceId == instanceId) {
+        return it.value();
+    }
+    if (it == frameStats_.end()) {
+        connect(frame, &QObject::destroyed, this,
+                [this](QObject* obj) { frameStats_.remove(obj); });
+    }
+    InstanceStats* entry = stats(pluginName, instanceId);
+    frameStats_.insert(frame, entry);
+    return entry;
+}
+
+QList<const InstanceStats*> PerfMonitor::allStats() const {
+    QList<const InstanceStats*> result;
+    result.reserve(stats_.size());
+    for (const auto& entry : stats_) {
+        result.append(entry.get());
+    }
+    return result;
+}
+
+const std::array<int, kStallBuckets>& PerfMonitor::stallBucketBounds() {
+    static const std::array<int, kStallBuckets> bounds{100, 250, 500, 1000, 2500, 5000, 0};
+    return bounds;
+}
+
+const std::array<quint64, kStallBuckets>& PerfMonitor::stallHistogram() const {
+    return histogram_;
+}
+
+qint64 PerfMonitor::stallTotalMs() const {
+    return stallTotalMs_;
+}
+
+void PerfMonitor::recordFrame(qint64 ns) {
+    const auto& bounds = frameBucketBounds();
+    const qint64 ms = ns / 1000000;
+    int bucket = kFrameBuckets - 1;
+    for (int i = 0; i < kFrameBuckets - 1; ++i) {
+        if (ms < bounds[i]) {
+            bucket = i;
+            break;
+        }
+    }
+    ++frames_.histogram[bucket];
+    frames_.totalNs += ns;
+    frames_.recentNs[frames_.count % kRecentFrames] = ns;
+    ++frames_.count;
+}
+
+const std::array<int, kFrameBuckets>& PerfMonitor::frameBucketBounds() {
+    static const std::array<int, kFrameBuckets> bounds{4, 8, 16, 33, 66, 0};
+    return bounds;
+}
+
+const FrameStats& PerfMonitor::frameStats() const {
+    return frames_;
+}
+
+qint64 PerfMonitor::heartbeatAgeMs() const {
+    return (clock_.nsecsElapsed() - lastBeatNs_.load(std::memory_order_relaxed)) / 1000000;
+}
+
+QString PerfMonitor::currentActivity() const {
+    const InstanceStats* stats = current_.load(std::memory_order_acquire);
+    if (!stats) {
+        return "host code";
+    }
+    auto call = static_cast<PluginCall>(currentCall_.load(std::memory_order_relaxed));
+    return QString("%1 %2 (%3)")
+        .arg(stats->pluginName,
+             stats->instanceId.isEmpty() ? QStringLiteral("<new>") : stats->instanceId,
+             pluginCallName(call));
+}
+
+void PerfMonitor::onHeartbeat() {
+    const qint64 now = clock_.nsecsElapsed();
+    const qint64 gapMs = (now - lastBeatNs_.exchange(now, std::memory_order_relaxed)) / 1000000;
+    if (stallThresholdMs_ > 0 && gapMs - kHeartbeatMs >= stallThresholdMs_) {
+        recordStall(gapMs - kHeartbeatMs);
+    }
+    worst_ = nullptr;
+    worstNs_ = 0;
+}
+
+void PerfMonitor::recordStall(qint64 ms) {
+    const auto& bounds = stallBucketBounds();
+    int bucket = kStallBuckets - 1;
+    for (int i = 0; i < kStallBuckets - 1; ++i) {
+        if (ms < bounds[i]) {
+            bucket = i;
+            break;
+        }
+    }
+    ++histogram_[bucket];
+    stallTotalMs_ += ms;
+
+    QString culprit = "host code";
+    if (worst_ && worstNs_ / 1000000 * 2 >= ms) {
+        // The slowest plugin call accounts for at least half of the stall
+        culprit = QString("%1 %2 (%3, %4 ms)")
+                      .arg(worst_->pluginName,
+                           worst_->instanceId.isEmpty() ? QStringLiteral("<new>")
+                                                        : worst_->instanceId,
+                           pluginCallName(worstCall_))
+                      .arg(worstNs_ / 1000000);
+    }
+    qWarning().noquote() << QString("Event loop stalled for %1 ms: %2").arg(ms).arg(culprit);
+    appendLog(QString("stall %1 ms: %2").arg(ms).arg(culprit));
+}
+
+void PerfMonitor::logHistogram() {
+    quint64 total = 0;
+    for (quint64 n : histogram_) {
+        total += n;
+    }
+    if (total == 0) {
+        return;
+    }
+    const auto& bounds = stallBucketBounds();
+    QStringList parts;
+    for (int i = 0; i < kStallBuckets; ++i) {
+        QString label = bounds[i] > 0 ? QString("<%1ms").arg(bounds[i])
+                                      : QString(">=%1ms").arg(bounds[i - 1]);
+        parts << QString("%1: %2").arg(label).arg(histogram_[i]);
+    }
+    appendLog("stall histogram " + parts.join(", "));
+}
+
+void PerfMonitor::appendLog(const QString& line) {
+    if (!logEnabled_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    QMutexLocker lock(&logMutex_);
+    const QString path = logFilePath();
+    QDir().mkpath(QFileInfo(path).absolutePath());
+    if (QFileInfo(path).size() > kMaxLogBytes) {
+        QFile::remove(path + ".1");
+        QFile::rename(path, path + ".1");
+    }
+    QFile file(path);
+    if (file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+        QTextStream out(&file);
+        out << QDateTime::currentDateTime().toString(Qt::ISODateWithMs) << ' ' << line << '\n';
+    }
+}
+
+PluginScope::PluginScope(InstanceStats* stats, PluginCall call)
+    : monitor_(PerfMonitor::instance()), stats_(stats), call_(call) {
+    if (!monitor_) {
+        return;
+    }
+    previous_ = monitor_->current_.exchange(stats_, std::memory_order_release);
+    previousCall_ = monitor_->currentCall_.exchange(int(call_), std::memory_order_relaxed);
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    previousHeapOwner_ = HeapAccounting::setCurrentOwner(stats_->heapOwner);
+#endif
+    timer_.start();
+}
+
+PluginScope::PluginScope(const QString& pluginName, const QString& instanceId, PluginCall call)
+    : PluginScope(PerfMonitor::instance() ? PerfMonitor::instance()->stats(pluginName, instanceId)
+                                          : nullptr,
+                  call) {}
+
+PluginScope::~PluginScope() {
+    if (!monitor_) {
+        return;
+    }
+    const qint64 ns = timer_.nsecsElapsed();
+#ifdef DASHBOARD_HEAP_ACCOUNTING
+    HeapAccounting::setCurrentOwner(previousHeapOwner_);
+#endif
+    monitor_->currentCall_.store(previousCall_, std::memory_order_relaxed);
+    monitor_->current_.store(previous_, std::memory_order_release);
+
+    PluginCallStats& call = stats_->calls[int(call_)];
+    ++call.count;
+    call.totalNs += ns;
+    call.maxNs = qMax(call.maxNs, ns);
+
+    if (ns > monitor_->worstNs_) {
+        monitor_->worst_ = stats_;
+        monitor_->worstCall_ = call_;
+        monitor_->worstNs_ = ns;
+    }
+
+    const qint64 ms = ns / 1000000;
+    if (monitor_->stallThresholdMs_ > 0 && ms >= monitor_->stallThresholdMs_) {
+        ++stats_->slowCalls;
+        emit monitor_->slowCall(stats_->pluginName, stats_->instanceId, call_, ms);
+    }
+}
+
+}  // namespace dashboard
@@ -0,0 +1,167 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+#include <array>
+#include <atomic>
+#include <memory>
+
+namespace dashboard {
+
+class StallWatchdog;
+
+// Host calls into a plugin that are timed and attributed to a widget instance.
+enum class PluginCall : int {
+    CreateWidget,
+    Deserialize,
+    Serialize,
+    Paint,
+    Event,
+};
+
+inline constexpr int kPluginCallKinds = 5;
+inline constexpr int kStallBuckets = 7;
+inline constexpr int kFrameBuckets = 6;
+inline constexpr int kRecentFrames = 512;
+
+const char* pluginCallName(PluginCall call);
+
+struct PluginCallStats {
+    quint64 count = 0;
+    qint64 totalNs = 0;
+    qint64 maxNs = 0;
+};
+
+// Per widget instance timings. Instances that do not have an ID yet
+// (createWidget during restore or add) are accounted under an empty ID.
+struct InstanceStats {
+    QString pluginName;
+    QString instanceId;
+    std::array<PluginCallStats, kPluginCallKinds> calls{};
+    quint64 slowCalls = 0;
+    int heapOwner = 0;  // see HeapAccounting
+};
+
+// Window repaints (backing store syncs), i.e. what the user perceives as frames.
+struct FrameStats {
+    quint64 count = 0;
+    qint64 totalNs = 0;
+    std::array<quint64, kFrameBuckets> histogram{};
+    std::array<qint64, kRecentFrames> recentNs{};  // ring buffer indexed by count
+};
+
+// Times every host call into plugin code, keeps an event-loop heartbeat for
+// the StallWatchdog and logs stalls with the widget responsible to
+// <AppConfigLocation>/diagnostics/stalls.log.
+class PerfMonitor : public QObject {
+    Q_OBJECT
+
+public:
+    explicit PerfMonitor(int stallThresholdMs, QObject* parent = nullptr);
+    ~PerfMonitor() override;
+
+    static PerfMonitor* instance();
+    static QString logFilePath();
+    // Off: stalls are still reported through qWarning but not appended to the log.
+    void setLogEnabled(bool enabled);
+
+    int stallThresholdMs() const;
+
+    InstanceStats* stats(const QString& pluginName, const QString& instanceId);
+    // Cached lookup for a widget frame; re-resolved when its instance ID changes.
+    InstanceStats* stats(QObject* frame, const QString& pluginName, const QString& instanceId);
+    QList<const InstanceStats*> allStats() const;
+
+    // Upper bounds (ms) of the stall duration histogram; the last bucket is open-ended.
+    static const std::array<int, kStallBuckets>& stallBucketBounds();
+    const std::array<quint64, kStallBuckets>& stallHistogram() const;
+    qint64 stallTotalMs() const;
+
+    void recordFrame(qint64 ns);
+    static const std::array<int, kFrameBuckets>& frameBucketBounds();
+    const FrameStats& frameStats() const;
+
+    // Safe to call from the watchdog thread.
+    qint64 heartbeatAgeMs() const;
+    QString currentActivity() const;
+    void appendLog(const QString& line);
+
+signals:
+    void slowCall(const QString& pluginName, const QString& instanceId, PluginCall call,
+                  qint64 ms);
+
+private:
+    friend class PluginScope;
+
+    void onHeartbeat();
+    void recordStall(qint64 ms);
+    void logHistogram();
+
+    int stallThresholdMs_;
+    QElapsedTimer clock_;
+    QTimer heartbeat_;
+    std::atomic<qint64> lastBeatNs_{0};
+
+    // Innermost running plugin call, read by the watchdog while the GUI thread is stuck.
+    // InstanceStats nodes are never freed before the watchdog stops, and their
+    // name fields never change, so reading them from another thread is safe.
+    std::atomic<InstanceStats*> current_{nullptr};
+    std::atomic<int> currentCall_{0};
+
+    // Slowest call since the last heartbeat; blamed if that interval was a stall
+    InstanceStats* worst_ = nullptr;
+    PluginCall worstCall_ = PluginCall::Event;
+    qint64 worstNs_ = 0;
+
+    QHash<QString, std::shared_ptr<InstanceStats>> stats_;
+    QHash<const QObject*, InstanceStats*> frameStats_;
+    std::array<quint64, kStallBuckets> histogram_{};
+    qint64 stallTotalMs_ = 0;
+    FrameStats frames_;
+    QMutex logMutex_;
+    std::atomic<bool> logEnabled_{true};  // read by the watchdog thread
+
+    std::unique_ptr<StallWatchdog> watchdog_;
+};
+
+// RAII scope around a call into plugin code. No-op when no PerfMonitor exists.
+// With heap accounting compiled in, allocations inside are charged to the plugin.
+class PluginScope {
+public:
+    PluginScope(InstanceStats* stats, PluginCall call);
+    PluginScope(const QString& pluginName, const QString& instanceId, PluginCall call);
+    ~PluginScope();
+
+    PluginScope(const PluginScope&) = delete;
+    PluginScope& operator=(const PluginScope&) = delete;
+
+private:
+    PerfMonitor* monitor_;
+    InstanceStats* stats_;
+    PluginCall call_;
+    InstanceStats* previous_ = nullptr;
+    int previousCall_ = 0;
+    int previousHeapOwner_ = 0;
+    QElapsedTimer timer_;
+};
+
+}  // namespace dashboard
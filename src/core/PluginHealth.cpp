@@ -0,0 +1,179 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PluginHealth.h"
+
+#include "IdleScheduler.h"
+#include "PluginIndex.h"
+
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <qlogging.h>
+
+namespace dashboard {
+
+QString PluginHealth::statePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/plugin-health.json";
+}
+
+QString PluginHealth::breadcrumbPath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/plugin-loading";
+}
+
+PluginHealth::PluginHealth(bool readOnly) : readOnly_(readOnly) {
+    QFile stateFile(statePath());
+    if (stateFile.open(QIODevice::ReadOnly)) {
+        const QJsonObject state = QJsonDocument::fromJson(stateFile.readAll()).object();
+        for (auto it = state.begin(); it != state.end(); ++it) {
+            const QJsonObject object = it.value().toObject();
+            Entry entry;
+            entry.fileId = object.value("fileId").toString().toUtf8();
+            entry.loadMs = object.value("loadMs").toInteger(-1);
+            entry.quarantined = object.value("quarantined").toBool();
+            entries_.insert(it.key(), entry);
+        }
+    }
+
+    if (readOnly_) {
+        return;
+    }
+    QFile breadcrumb(breadcrumbPath());
+    if (breadcrumb.open(QIODevice::ReadOnly)) {
+        const QString filePath = QString::fromUtf8(breadcrumb.readAll());
+        breadcrumb.close();
+        breadcrumb.remove();
+        if (!filePath.isEmpty()) {
+            qWarning() << "The previous run stopped while loading" << filePath
+                       << "- quarantining it";
+            Entry& entry = entries_[filePath];
+            entry.fileId = PluginIndex::fileId(filePath);
+            entry.quarantined = true;
+            save();
+        }
+    }
+}
+
+PluginHealth::~PluginHealth() {
+    if (saveTask_ != 0) {
+        if (auto* idle = IdleScheduler::instance()) {
+            idle->cancel(saveTask_);
+        }
+        save();
+    }
+}
+
+const PluginHealth::Entry* PluginHealth::current(const QString& filePath) const {
+    auto it = entries_.constFind(filePath);
+    if (it == entries_.cend() || it->fileId != PluginIndex::fileId(filePath)) {
+        return nullptr;
+    }
+    return &*it;
+}
+
+bool PluginHealth::isQuarantined(const QString& filePath) const {
+    const Entry* entry = current(filePath);
+    return entry && entry->quarantined;
+}
+
+QStringList PluginHealth::quarantined() const {
+    QStringList result;
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it) {
+        if (isQuarantined(it.key())) {
+            result.append(it.key());
+        }
+    }
+    result.sort();
+    return result;
+}
+
+void PluginHealth::lift(const QString& filePath) {
+    auto it = entries_.find(filePath);
+    if (it != entries_.end() && it->quarantined) {
+        it->quarantined = false;
+        save();
+    }
+}
+
+qint64 PluginHealth::lastLoadMs(const QString& filePath) const {
+    const Entry* entry = current(filePath);
+    return entry ? entry->loadMs : -1;
+}
+
+void PluginHealth::beginLoad(const QString& filePath) {
+    if (readOnly_) {
+        return;
+    }
+    // Closed before loading starts so the name is on disk if the load takes the process down
+    QDir().mkpath(QFileInfo(breadcrumbPath()).absolutePath());
+    QFile breadcrumb(breadcrumbPath());
+    if (breadcrumb.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        breadcrumb.write(filePath.toUtf8());
+    }
+}
+
+void PluginHealth::endLoad(const QString& filePath, qint64 elapsedNs) {
+    if (!readOnly_) {
+        QFile::remove(breadcrumbPath());
+    }
+    Entry& entry = entries_[filePath];
+    entry.fileId = PluginIndex::fileId(filePath);
+    entry.loadMs = elapsedNs / 1000000;
+    entry.quarantined = false;
+    scheduleSave();
+}
+
+void PluginHealth::scheduleSave() {
+    if (readOnly_) {
+        return;
+    }
+    auto* idle = IdleScheduler::instance();
+    if (!idle) {
+        save();
+        return;
+    }
+    // Posting again under the same name keeps the pending task and its id
+    saveTask_ = idle->post("plugin-health", [this]() {
+        saveTask_ = 0;
+        save();
+        return false;
+    }, IdleScheduler::Priority::Low);
+}
+
+void PluginHealth::save() {
+    if (readOnly_) {
+        return;
+    }
+    QJsonObject state;
+    for (auto it = entries_.cbegin(); it != entries_.cend(); ++it) {
+        state.insert(it.key(), QJsonObject{
+                                   {"fileId", QString::fromUtf8(it->fileId)},
+                                   {"loadMs", it->loadMs},
+                                   {"quarantined", it->quarantined},
+                               });
+    }
+    QDir().mkpath(QFileInfo(statePath()).absolutePath());
+    QSaveFile file(statePath());
+    if (file.open(QIODevice::WriteOnly)) {
+        file.write(QJsonDocument(state).toJson(QJsonDocument::Compact));
+        file.commit();
+    }
+}
+
+}  // namespace dashboard
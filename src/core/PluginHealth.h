@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace dashboard {
+
+// Load times and crash quarantine of plugin libraries, kept across runs in
+// <CacheLocation>/plugin-health.json. While a library's static initializers
+// and plugin constructor run, a breadcrumb file names it; if the process dies
+// there, the next start finds the breadcrumb and quarantines that library.
+// A quarantined library is not loaded again until the user retries it or the
+// file is replaced.
+class PluginHealth {
+public:
+    static QString statePath();
+    static QString breadcrumbPath();
+
+    // Reads the saved state and turns a leftover breadcrumb into a quarantine.
+    // A read-only instance (headless runs next to the GUI) ignores the
+    // breadcrumb, whose load may still be under way, and writes nothing.
+    explicit PluginHealth(bool readOnly = false);
+    // Writes load times that are still waiting for an idle moment
+    ~PluginHealth();
+
+    bool isQuarantined(const QString& filePath) const;
+    QStringList quarantined() const;
+    void lift(const QString& filePath);
+    // Duration of the last load in ms, or -1 if it was never loaded
+    qint64 lastLoadMs(const QString& filePath) const;
+
+    // Around QPluginLoader::instance(). The load time is saved once the loads
+    // of a burst (e.g. a restore) are over, in an IdleScheduler slice.
+    void beginLoad(const QString& filePath);
+    void endLoad(const QString& filePath, qint64 elapsedNs);
+
+private:
+    struct Entry {
+        // PluginIndex::fileId() at the time; a replaced library starts over
+        QByteArray fileId;
+        qint64 loadMs = -1;
+        bool quarantined = false;
+    };
+
+    const Entry* current(const QString& filePath) const;
+    void scheduleSave();
+    void save();
+
+    QHash<QString, Entry> entries_;
+    bool readOnly_ = false;
+    int saveTask_ = 0;  // IdleScheduler task id, 0 when none is pending
+};
+
+}  // namespace dashboard
@@ -0,0 +1,224 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PluginIndex.h"
+
+#include "PluginLoader.h"
+
+#include <dashboard/IWidget.h>
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QPluginLoader>
+#include <QProcess>
+#include <QSaveFile>
+#include <QStandardPaths>
+#include <QWidget>
+#include <qlogging.h>
+
+namespace dashboard {
+
+// A library whose constructor hangs must not stall startup for long
+static constexpr int kDescribeTimeoutMs = 10000;
+
+static QSize sizeFromJson(const QJsonValue& value) {
+    // Either [width, height] or {"width": .., "height": ..}
+    if (value.isArray()) {
+        const QJsonArray array = value.toArray();
+        return QSize(array.at(0).toInt(), array.at(1).toInt());
+    }
+    const QJsonObject object = value.toObject();
+    return QSize(object.value("width").toInt(), object.value("height").toInt());
+}
+
+static QJsonArray sizeToJson(const QSize& size) {
+    return QJsonArray{size.width(), size.height()};
+}
+
+QString PluginIndex::cachePath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/plugin-index.json";
+}
+
+QByteArray PluginIndex::fileId(const QString& filePath) {
+    QFileInfo info(filePath);
+    return QByteArray::number(info.size()) + '-'
+           + QByteArray::number(info.lastModified().toMSecsSinceEpoch());
+}
+
+void PluginIndex::setIsolated(bool isolated) {
+    isolated_ = isolated;
+}
+
+void PluginIndex::setReadOnly(bool readOnly) {
+    readOnly_ = readOnly;
+}
+
+void PluginIndex::scan(PluginLoader& pluginLoader) {
+    // Plugins compiled into the executable have no file to rescan
+    std::vector<PluginInfo> builtins;
+    for (const auto& info : plugins_) {
+        if (info.filePath.isEmpty()) {
+            builtins.push_back(info);
+        }
+    }
+    plugins_.clear();
+    byName_.clear();
+    for (const auto& info : builtins) {
+        add(info);
+    }
+
+    QFile cacheFile(cachePath());
+    QJsonObject cache;
+    if (cacheFile.open(QIODevice::ReadOnly)) {
+        cache = QJsonDocument::fromJson(cacheFile.readAll()).object();
+        cacheFile.close();
+    }
+    QJsonObject updated;
+
+    for (const auto& filePath : pluginLoader.pluginFiles()) {
+        // Reads the .qtmetadata section only; the library is not dlopen'ed
+        const QJsonObject metaData = QPluginLoader(filePath).metaData();
+        if (metaData.value("IID").toString() != QLatin1String(qobject_interface_iid<IWidget*>())) {
+            continue;
+        }
+
+        PluginInfo info;
+        info.filePath = filePath;
+        info.fileId = fileId(filePath);
+        const QJsonObject embeddedMeta = metaData.value("MetaData").toObject();
+        const bool embedded = fromEmbedded(embeddedMeta, info);
+        const QJsonObject cached = cache.value(filePath).toObject();
+        if (!embedded) {
+            if (cached.value("fileId").toString().toUtf8() == info.fileId) {
+                info = fromJson(cached);
+                info.filePath = filePath;
+            } else if (isolated_) {
+                info = describe(filePath);
+                if (info.name.isEmpty()) {
+                    continue;
+                }
+                info.filePath = filePath;
+                info.fileId = fileId(filePath);
+            } else if (IWidget* widget = pluginLoader.load(filePath)) {
+                // New or replaced library: the only case that costs a dlopen
+                const auto meta = widget->metadata();
+                info.name = PluginLoader::ownedCopy(meta.name);
+                info.description = PluginLoader::ownedCopy(meta.description);
+                info.defaultSize = meta.defaultSize;
+                info.minSize = meta.minSize;
+                info.maxSize = meta.maxSize;
+                info.loadTimeNs = pluginLoader.loadTimesNs().value(filePath);
+            } else {
+                continue;
+            }
+        }
+        info.cacheable = embeddedMeta.value("cacheable").toBool();
+
+        if (!add(info)) {
+            // Same plugin found in a later search path: the first one wins
+            pluginLoader.unload(filePath);
+            continue;
+        }
+        if (!embedded) {
+            updated.insert(filePath, toJson(info));
+        }
+    }
+
+    if (updated != cache && !readOnly_) {
+        QDir().mkpath(QFileInfo(cachePath()).absolutePath());
+        QSaveFile file(cachePath());
+        if (file.open(QIODevice::WriteOnly)) {
+            file.write(QJsonDocument(updated).toJson(QJsonDocument::Compact));
+            file.commit();
+        }
+    }
+}
+
+bool PluginIndex::add(const PluginInfo& info) {
+    if (byName_.contains(info.name)) {
+        return false;
+    }
+    byName_.insert(info.name, int(plugins_.size()));
+    plugins_.push_back(info);
+    return true;
+}
+
+const std::vector<PluginInfo>& PluginIndex::plugins() const {
+    return plugins_;
+}
+
+PluginInfo* PluginIndex::find(const QString& name) {
+    auto it = byName_.constFind(name);
+    return it == byName_.cend() ? nullptr : &plugins_[*it];
+}
+
+const PluginInfo* PluginIndex::find(const QString& name) const {
+    auto it = byName_.constFind(name);
+    return it == byName_.cend() ? nullptr : &plugins_[*it];
+}
+
+PluginInfo PluginIndex::describe(const QString& filePath) {
+    QProcess helper;
+    helper.start(QCoreApplication::applicationFilePath(), {"--describe-plugin", filePath});
+    if (!helper.waitForFinished(kDescribeTimeoutMs) || helper.exitStatus() != QProcess::NormalExit
+        || helper.exitCode() != 0) {
+        helper.kill();
+        qWarning() << "Failed to describe plugin:" << filePath;
+        return {};
+    }
+    return fromJson(QJsonDocument::fromJson(helper.readAllStandardOutput()).object());
+}
+
+bool PluginIndex::fromEmbedded(const QJsonObject& metaData, PluginInfo& info) {
+    if (!metaData.contains("name") || !metaData.contains("defaultSize")) {
+        return false;
+    }
+    info.name = metaData.value("name").toString();
+    info.description = metaData.value("description").toString();
+    info.defaultSize = sizeFromJson(metaData.value("defaultSize"));
+    info.minSize = metaData.contains("minSize") ? sizeFromJson(metaData.value("minSize"))
+                                                : QSize(0, 0);
+    info.maxSize = metaData.contains("maxSize") ? sizeFromJson(metaData.value("maxSize"))
+                                                : QSize(QWIDGETSIZE_MAX, QWIDGETSIZE_MAX);
+    return !info.name.isEmpty();
+}
+
+QJsonObject PluginIndex::toJson(const PluginInfo& info) {
+    return QJsonObject{
+        {"fileId", QString::fromUtf8(info.fileId)},
+        {"name", info.name},
+        {"description", info.description},
+        {"defaultSize", sizeToJson(info.defaultSize)},
+        {"minSize", sizeToJson(info.minSize)},
+        {"maxSize", sizeToJson(info.maxSize)},
+    };
+}
+
+PluginInfo PluginIndex::fromJson(const QJsonObject& object) {
+    PluginInfo info;
+    info.fileId = object.value("fileId").toString().toUtf8();
+    info.name = object.value("name").toString();
+    info.description = object.value("description").toString();
+    info.defaultSize = sizeFromJson(object.value("defaultSize"));
+    info.minSize = sizeFromJson(object.value("minSize"));
+    info.maxSize = sizeFromJson(object.value("maxSize"));
+    return info;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,86 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QHash>
+#include <QJsonObject>
+#include <QSize>
+#include <QString>
+#include <vector>
+
+namespace dashboard {
+
+class PluginLoader;
+
+// What the dashboard knows about a plugin whether or not its library is loaded.
+struct PluginInfo {
+    QString filePath;
+    // Size and modification time; changes whenever the library is replaced
+    QByteArray fileId;
+    QString name;
+    QString description;
+    QSize defaultSize;
+    QSize minSize;
+    QSize maxSize;
+    qint64 loadTimeNs = 0;
+    // "cacheable" in the embedded metadata: cards may rest on a snapshot right
+    // after they settle (see ContentCache)
+    bool cacheable = false;
+};
+
+// Metadata of every plugin in the search paths, built without loading the
+// libraries. It is read from the JSON embedded by Q_PLUGIN_METADATA when the
+// plugin provides name and sizes there. Otherwise it comes from
+// <CacheLocation>/plugin-index.json, and only a new or replaced library is
+// loaded once to ask IWidget::metadata(), in a helper process when widgets
+// are isolated.
+class PluginIndex {
+public:
+    static QString cachePath();
+    static QByteArray fileId(const QString& filePath);
+    static QJsonObject toJson(const PluginInfo& info);
+    static PluginInfo fromJson(const QJsonObject& object);
+
+    // New libraries are described by `dashboard --describe-plugin` instead of
+    // being loaded into this process (see PreviewHost).
+    void setIsolated(bool isolated);
+    // Scans without rewriting plugin-index.json.
+    void setReadOnly(bool readOnly);
+
+    // Rebuilds the index from the search paths. Libraries loaded to read their
+    // metadata stay loaded in pluginLoader.
+    void scan(PluginLoader& pluginLoader);
+
+    // Adds a plugin unless one of that name is indexed. Plugins compiled into
+    // the executable (empty filePath) are kept across scans.
+    bool add(const PluginInfo& info);
+
+    const std::vector<PluginInfo>& plugins() const;
+    PluginInfo* find(const QString& name);
+    const PluginInfo* find(const QString& name) const;
+
+private:
+    static bool fromEmbedded(const QJsonObject& metaData, PluginInfo& info);
+    static PluginInfo describe(const QString& filePath);
+
+    std::vector<PluginInfo> plugins_;
+    QHash<QString, int> byName_;
+    bool isolated_ = false;
+    bool readOnly_ = false;
+};
+
+}  // namespace dashboard
@@ -17,12 +17,13 @@
 
 #include <QCoreApplication>
 #include <QDirIterator>
+#include <QElapsedTimer>
 #include <QPluginLoader>
 #include <qlogging.h>
 
 namespace dashboard {
 
-PluginLoader::PluginLoader() {
+PluginLoader::PluginLoader(bool readOnly) : health_(readOnly), readOnly_(readOnly) {
     // Default: look for plugins next to the executable
     addSearchPath(QCoreApplication::applicationDirPath() + "/plugins");
 
@@ -42,45 +43,98 @@ QStringList PluginLoader::searchPaths() const {
     return searchPaths_;
 }
 
-std::vector<IWidget*> PluginLoader::loadAll() {
-    std::vector<IWidget*> widgets;
-
+QStringList PluginLoader::pluginFiles() const {
+    QStringList files;
     for (const auto& searchPath : searchPaths_) {
         QDir dir(searchPath);
         if (!dir.exists()) {
             continue;
         }
-
         const auto entries = dir.entryList(QDir::Files);
         for (const auto& fileName : entries) {
-            QString filePath = dir.absoluteFilePath(fileName);
-
-            if (loaded_.contains(filePath)) {
-                if (auto* w = qobject_cast<IWidget*>(loaded_[filePath]->instance())) {
-                    widgets.push_back(w);
-                }
-                continue;
-            }
-
-            auto* loader = new QPluginLoader(filePath);
-            if (QObject* instance = loader->instance()) {
-                if (auto* widget = qobject_cast<IWidget*>(instance)) {
-                    qInfo() << "Loaded widget plugin:" << filePath;
-                    loaded_[filePath] = loader;
-                    widgets.push_back(widget);
-                } else {
-                    qWarning() << "Plugin does not implement IWidget:" << filePath;
-                    loader->unload();
-                    delete loader;
-                }
-            } else {
-                qWarning() << "Failed to load plugin:" << filePath << loader->errorString();
-                delete loader;
-            }
+            files.append(dir.absoluteFilePath(fileName));
         }
     }
+    return files;
+}
+
+IWidget* PluginLoader::load(const QString& filePath) {
+    if (loaded_.contains(filePath)) {
+        return qobject_cast<IWidget*>(loaded_[filePath]->instance());
+    }
+
+    if (health_.isQuarantined(filePath)) {
+        qWarning() << "Not loading quarantined plugin:" << filePath;
+        return nullptr;
+    }
+
+    auto* loader = new QPluginLoader(filePath);
+    QElapsedTimer timer;
+    health_.beginLoad(filePath);
+    timer.start();
+    QObject* instance = loader->instance();
+    const qint64 elapsedNs = timer.nsecsElapsed();
+    health_.endLoad(filePath, elapsedNs);
+    if (!instance) {
+        qWarning() << "Failed to load plugin:" << filePath << loader->errorString();
+        delete loader;
+        return nullptr;
+    }
+    auto* widget = qobject_cast<IWidget*>(instance);
+    if (!widget) {
+        qWarning() << "Plugin does not implement IWidget:" << filePath;
+        loader->unload();
+        delete loader;
+        return nullptr;
+    }
+    qInfo() << "Loaded widget plugin:" << filePath;
+    loaded_[filePath] = loader;
+    loadTimesNs_[filePath] = elapsedNs;
+    return widget;
+}
+
+void PluginLoader::unload(const QString& filePath) {
+    QPluginLoader* loader = loaded_.take(filePath);
+    if (!loader) {
+        return;
+    }
+    if (!loader->unload()) {
+        qWarning() << "Failed to unload plugin:" << filePath << loader->errorString();
+    }
+    delete loader;
+}
 
-    return widgets;
+bool PluginLoader::isLoaded(const QString& filePath) const {
+    return loaded_.contains(filePath);
+}
+
+const QHash<QString, qint64>& PluginLoader::loadTimesNs() const {
+    return loadTimesNs_;
+}
+
+PluginHealth& PluginLoader::health() {
+    return health_;
+}
+
+const PluginHealth& PluginLoader::health() const {
+    return health_;
+}
+
+bool PluginLoader::isReadOnly() const {
+    return readOnly_;
+}
+
+QString PluginLoader::ownedCopy(const QString& text) {
+    return QString(text.constData(), text.size());
+}
+
+QString PluginLoader::filePath(const IWidget* widget) const {
+    for (auto it = loaded_.cbegin(); it != loaded_.cend(); ++it) {
+        if (qobject_cast<IWidget*>(it.value()->instance()) == widget) {
+            return it.key();
+        }
+    }
+    return {};
 }
 
 }  // namespace dashboard
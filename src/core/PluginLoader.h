@@ -17,7 +17,10 @@
 
 #include <dashboard/IWidget.h>
 
+#include "PluginHealth.h"
+
 #include <QDir>
+#include <QHash>
 #include <QMap>
 #include <QPluginLoader>
 #include <QString>
@@ -29,16 +32,37 @@ namespace dashboard {
 
 class PluginLoader {
 public:
-    PluginLoader();
+    // readOnly: plugin health and the plugin index are read but never written
+    explicit PluginLoader(bool readOnly = false);
 
     void addSearchPath(const QString& path);
     QStringList searchPaths() const;
 
-    std::vector<IWidget*> loadAll();
+    // Plugin library candidates in all search paths.
+    QStringList pluginFiles() const;
+    // Loads a single library, or returns its instance if already loaded.
+    // Refuses libraries that PluginHealth has quarantined.
+    IWidget* load(const QString& filePath);
+    // Deletes the plugin instance and unmaps the library.
+    void unload(const QString& filePath);
+    bool isLoaded(const QString& filePath) const;
+
+    QString filePath(const IWidget* widget) const;
+    // A copy of a string a plugin returned that stays valid after unload():
+    // QStringLiteral data lives in the library's read-only segment.
+    static QString ownedCopy(const QString& text);
+    // Time spent in dlopen and plugin construction, per loaded file.
+    const QHash<QString, qint64>& loadTimesNs() const;
+    PluginHealth& health();
+    const PluginHealth& health() const;
+    bool isReadOnly() const;
 
 private:
     QStringList searchPaths_;
     QMap<QString, QPluginLoader*> loaded_;
+    QHash<QString, qint64> loadTimesNs_;
+    PluginHealth health_;
+    bool readOnly_;
 };
 
 }  // namespace dashboard
@@ -0,0 +1,95 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PowerProfile.h"
+
+#include "ConfigStore.h"
+
+#include <QDir>
+#include <QFile>
+
+namespace dashboard {
+
+// sysfs attributes cannot be watched; a slow poll is enough for plug/unplug
+static constexpr int kPollMs = 30000;
+
+static PowerProfile* s_instance = nullptr;
+
+static QByteArray readAttribute(const QString& path) {
+    QFile file(path);
+    return file.open(QIODevice::ReadOnly) ? file.readAll().trimmed() : QByteArray();
+}
+
+PowerProfile::PowerProfile(ConfigStore& config, QObject* parent)
+    : QObject(parent), config_(config) {
+    s_instance = this;
+    pollTimer_.setTimerType(Qt::VeryCoarseTimer);
+    pollTimer_.setInterval(kPollMs);
+    connect(&pollTimer_, &QTimer::timeout, this, &PowerProfile::update);
+    connect(&config_, &ConfigStore::valueChanged, this, [this](const QString& key) {
+        if (key == config::powerProfile.name) {
+            update();
+        }
+    });
+    update();
+}
+
+PowerProfile::~PowerProfile() {
+    s_instance = nullptr;
+}
+
+PowerProfile* PowerProfile::instance() {
+    return s_instance;
+}
+
+bool PowerProfile::onBattery() {
+    const QDir dir("/sys/class/power_supply");
+    bool hasBattery = false;
+    for (const auto& name : dir.entryList(QDir::Dirs | QDir::NoDotAndDotDot)) {
+        const QString base = dir.filePath(name);
+        const QByteArray type = readAttribute(base + "/type");
+        if (type == "Mains" || type == "USB") {
+            if (readAttribute(base + "/online") == "1") {
+                return false;
+            }
+        } else if (type == "Battery") {
+            hasBattery = true;
+        }
+    }
+    return hasBattery;
+}
+
+bool PowerProfile::isLowPower() const {
+    return lowPower_;
+}
+
+void PowerProfile::update() {
+    const QString profile = config_.get(config::powerProfile);
+    const bool automatic = profile != "low" && profile != "normal";
+    // Only poll when the answer depends on the power source
+    if (automatic && !pollTimer_.isActive()) {
+        pollTimer_.start();
+    } else if (!automatic) {
+        pollTimer_.stop();
+    }
+
+    const bool lowPower = profile == "low" || (automatic && onBattery());
+    if (lowPower != lowPower_) {
+        lowPower_ = lowPower;
+        emit changed(lowPower_);
+    }
+}
+
+}  // namespace dashboard
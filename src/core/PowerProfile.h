@@ -0,0 +1,59 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+namespace dashboard {
+
+class ConfigStore;
+
+// Decides whether the dashboard renders in its low-power profile: always,
+// never, or ("auto") while no mains supply is online according to
+// /sys/class/power_supply. Widgets see the profile as the dynamic property
+// kLowPowerProperty on their content widget (set by WidgetCanvas) and
+// receive a QEvent::DynamicPropertyChange when it flips.
+class PowerProfile : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr const char* kLowPowerProperty = "dashboardLowPower";
+    // Minimum time between repaints of a window while in low power
+    static constexpr int kLowPowerFrameIntervalMs = 66;
+
+    explicit PowerProfile(ConfigStore& config, QObject* parent = nullptr);
+    ~PowerProfile() override;
+
+    static PowerProfile* instance();
+    // True while a battery is the only power source. False where unknown.
+    static bool onBattery();
+
+    bool isLowPower() const;
+
+signals:
+    void changed(bool lowPower);
+
+private:
+    void update();
+
+    ConfigStore& config_;
+    QTimer pollTimer_;
+    bool lowPower_ = false;
+};
+
+}  // namespace dashboard
@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ProcessMemory.h"
+
+#include <QFile>
+#include <QFileInfo>
+
+#include <unistd.h>
+
+namespace dashboard {
+
+QHash<QString, qint64> ProcessMemory::mappedResidentBytes(const QStringList& filePaths) {
+    // smaps reports resolved paths; map them back to what the caller passed in
+    QHash<QString, QString> byCanonical;
+    QHash<QString, qint64> result;
+    for (const auto& path : filePaths) {
+        byCanonical.insert(QFileInfo(path).canonicalFilePath(), path);
+        result.insert(path, 0);
+    }
+
+    QFile file("/proc/self/smaps");
+    if (!file.open(QIODevice::ReadOnly | QIODevice::Text)) {
+        return result;
+    }
+
+    const QString* current = nullptr;
+    while (!file.atEnd()) {
+        const QByteArray line = file.readLine();
+        const QByteArray first = line.left(line.indexOf(' '));
+        if (first.endsWith(':')) {
+            // Field line, e.g. "Rss:     132 kB"
+            if (current && first == "Rss:") {
+                result[*current] += line.mid(4).simplified().split(' ').value(0).toLongLong() * 1024;
+            }
+            continue;
+        }
+        // Mapping header: "start-end perms offset dev inode [path]"
+        const int pathStart = line.indexOf('/');
+        if (pathStart < 0) {
+            current = nullptr;
+            continue;
+        }
+        auto it = byCanonical.constFind(QString::fromLocal8Bit(line.mid(pathStart).trimmed()));
+        current = it != byCanonical.constEnd() ? &it.value() : nullptr;
+    }
+    return result;
+}
+
+qint64 ProcessMemory::residentBytes() {
+    QFile file("/proc/self/statm");
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    const QList<QByteArray> fields = file.readAll().split(' ');
+    return fields.value(1).toLongLong() * sysconf(_SC_PAGESIZE);
+}
+
+}  // namespace dashboard
@@ -0,0 +1,32 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+
+namespace dashboard {
+
+// Process memory figures read from /proc/self (Linux only; zero elsewhere).
+class ProcessMemory {
+public:
+    // Resident bytes of the mappings backed by each file, keyed by the path as given.
+    static QHash<QString, qint64> mappedResidentBytes(const QStringList& filePaths);
+    static qint64 residentBytes();
+};
+
+}  // namespace dashboard
@@ -0,0 +1,47 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "RemotePlugin.h"
+
+namespace dashboard {
+
+RemotePlugin::RemotePlugin(const PluginInfo& info) : info_(info) {}
+
+const QString& RemotePlugin::filePath() const {
+    return info_.filePath;
+}
+
+RemotePlugin::Metadata RemotePlugin::metadata() const {
+    Metadata meta{};
+    meta.name = info_.name;
+    meta.description = info_.description;
+    meta.defaultSize = info_.defaultSize;
+    meta.minSize = info_.minSize;
+    meta.maxSize = info_.maxSize;
+    return meta;
+}
+
+QWidget* RemotePlugin::createWidget(QWidget* /*parent*/) {
+    // The canvas's content factory creates a RemoteWidgetView instead
+    return nullptr;
+}
+
+QJsonObject RemotePlugin::serialize() const {
+    return {};
+}
+
+void RemotePlugin::deserialize(const QJsonObject& /*data*/) {}
+
+}  // namespace dashboard
@@ -0,0 +1,52 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <dashboard/IWidget.h>
+
+#include "PluginIndex.h"
+
+#include <QJsonObject>
+#include <type_traits>
+#include <utility>
+
+class QWidget;
+
+namespace dashboard {
+
+// Stands in for a plugin whose widgets run in helper processes (isolated
+// widgets). metadata() is answered from the PluginIndex, so the dashboard
+// process never loads the library. The canvas creates a RemoteWidgetView for
+// the content, and the helper saves and restores the widget's state.
+class RemotePlugin : public IWidget {
+public:
+    // Whatever metadata() of the SDK returns
+    using Metadata = std::remove_cvref_t<decltype(std::declval<const IWidget&>().metadata())>;
+
+    explicit RemotePlugin(const PluginInfo& info);
+
+    const QString& filePath() const;
+
+    Metadata metadata() const override;
+    QWidget* createWidget(QWidget* parent) override;
+    QJsonObject serialize() const override;
+    void deserialize(const QJsonObject& data) override;
+
+private:
+    PluginInfo info_;
+};
+
+}  // namespace dashboard
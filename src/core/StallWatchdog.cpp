@@ -0,0 +1,54 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "StallWatchdog.h"
+
+#include "PerfMonitor.h"
+
+#include <qlogging.h>
+
+namespace dashboard {
+
+StallWatchdog::StallWatchdog(PerfMonitor& monitor, QObject* parent)
+    : QThread(parent), monitor_(monitor) {
+    setObjectName("StallWatchdog");
+}
+
+void StallWatchdog::run() {
+    const int threshold = monitor_.stallThresholdMs();
+    const int interval = qMax(10, threshold / 4);
+    bool reported = false;
+
+    while (!isInterruptionRequested()) {
+        msleep(interval);
+        const qint64 age = monitor_.heartbeatAgeMs();
+        if (age < threshold) {
+            reported = false;
+            continue;
+        }
+        // Report once per stall while it is still in progress; the full duration
+        // is logged by PerfMonitor when the event loop comes back.
+        if (!reported) {
+            reported = true;
+            const QString activity = monitor_.currentActivity();
+            qWarning().noquote() << QString("Event loop blocked for %1 ms, running: %2")
+                                        .arg(age)
+                                        .arg(activity);
+            monitor_.appendLog(QString("blocked %1 ms, running: %2").arg(age).arg(activity));
+        }
+    }
+}
+
+}  // namespace dashboard
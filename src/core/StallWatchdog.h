@@ -0,0 +1,39 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QThread>
+
+namespace dashboard {
+
+class PerfMonitor;
+
+// Background thread that notices when the GUI event loop has not turned over
+// for longer than the stall threshold and reports which plugin call is running.
+class StallWatchdog : public QThread {
+    Q_OBJECT
+
+public:
+    explicit StallWatchdog(PerfMonitor& monitor, QObject* parent = nullptr);
+
+protected:
+    void run() override;
+
+private:
+    PerfMonitor& monitor_;
+};
+
+}  // namespace dashboard
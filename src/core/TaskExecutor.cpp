@@ -0,0 +1,67 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "TaskExecutor.h"
+
+#include <QThread>
+#include <algorithm>
+
+namespace dashboard {
+
+static constexpr int kBackgroundThreads = 2;
+// Leaves a core for the GUI thread where there are enough of them
+static constexpr int kMinThreads = 2;
+
+static TaskExecutor* s_instance = nullptr;
+
+TaskExecutor::TaskExecutor(QObject* parent) : QObject(parent) {
+    s_instance = this;
+    pool_.setObjectName("dashboard-pool");
+    pool_.setMaxThreadCount(std::max(kMinThreads, QThread::idealThreadCount() - 1));
+    backgroundPool_.setObjectName("dashboard-background");
+    backgroundPool_.setMaxThreadCount(kBackgroundThreads);
+    backgroundPool_.setThreadPriority(QThread::LowPriority);
+}
+
+TaskExecutor::~TaskExecutor() {
+    if (s_instance == this) {
+        s_instance = nullptr;
+    }
+    pool_.waitForDone();
+    backgroundPool_.waitForDone();
+}
+
+TaskExecutor* TaskExecutor::instance() {
+    return s_instance;
+}
+
+QThreadPool* TaskExecutor::pool(Lane lane) {
+    return lane == Lane::Background ? &backgroundPool_ : &pool_;
+}
+
+int TaskExecutor::priority(Lane lane) {
+    return lane == Lane::Interactive ? 1 : 0;
+}
+
+void TaskExecutor::submit(Lane lane, std::function<void()> job) {
+    pool(lane)->start(std::move(job), priority(lane));
+}
+
+void TaskExecutor::setPoolProperties(QObject* content) {
+    content->setProperty(kPoolProperty, QVariant::fromValue<QObject*>(&pool_));
+    content->setProperty(kBackgroundPoolProperty, QVariant::fromValue<QObject*>(&backgroundPool_));
+}
+
+}  // namespace dashboard
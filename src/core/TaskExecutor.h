@@ -0,0 +1,71 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "core/Async.h"
+
+#include <QObject>
+#include <QThreadPool>
+#include <functional>
+#include <utility>
+
+namespace dashboard {
+
+// Host-owned thread pools for work that must not run on the GUI thread:
+// parsing, disk reads, decoding. Interactive and Normal jobs share a pool sized
+// to the CPU, Interactive ahead of Normal; Background jobs (bulk I/O,
+// compaction) get a small pool of their own so they never hold up the others.
+// Pairs with the awaitables in Async.h.
+//
+// Widgets find the pools as the dynamic properties kPoolProperty and
+// kBackgroundPoolProperty (QThreadPool* as QObject*) on their content widget.
+class TaskExecutor : public QObject {
+    Q_OBJECT
+
+public:
+    static constexpr const char* kPoolProperty = "dashboardThreadPool";
+    static constexpr const char* kBackgroundPoolProperty = "dashboardBackgroundPool";
+
+    enum class Lane { Interactive, Normal, Background };
+
+    explicit TaskExecutor(QObject* parent = nullptr);
+    // Waits for running jobs; queued ones still run first
+    ~TaskExecutor() override;
+
+    static TaskExecutor* instance();
+
+    QThreadPool* pool(Lane lane);
+    // QThreadPool priority of the lane's jobs
+    static int priority(Lane lane);
+
+    void submit(Lane lane, std::function<void()> job);
+
+    // co_await executor->on(lane): continue on a pool thread
+    ResumeOn on(Lane lane) { return resumeOn(pool(lane), priority(lane)); }
+    // co_await executor->run(lane, f): run f on the lane, continue on the GUI thread
+    template <typename F>
+    auto run(Lane lane, F&& function) {
+        return runOn(pool(lane), priority(lane), std::forward<F>(function));
+    }
+
+    void setPoolProperties(QObject* content);
+
+private:
+    QThreadPool pool_;
+    QThreadPool backgroundPool_;
+};
+
+}  // namespace dashboard
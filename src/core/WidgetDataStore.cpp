@@ -15,6 +15,8 @@
 
 #include "WidgetDataStore.h"
 
+#include "Metrics.h"
+
 #include <QDir>
 #include <QFile>
 #include <QJsonDocument>
@@ -41,7 +43,7 @@ void WidgetDataStore::save(const QString& instanceId, const QJsonObject& data) {
     QDir().mkpath(dirPath());
     QFile file(filePath(instanceId));
     if (file.open(QFile::WriteOnly)) {
-        file.write(QJsonDocument(data).toJson());
+        metrics::recordWrite(metrics::Store::WidgetData, file.write(QJsonDocument(data).toJson()));
     }
 }
 
@@ -16,34 +16,198 @@
 #include "WidgetManager.h"
 
 #include "PluginLoader.h"
+#include "ProcessMemory.h"
+#include "RemotePlugin.h"
+
+#include <QTimer>
+#include <qlogging.h>
 
 namespace dashboard {
 
+// Long enough that deleting a card and adding it back does not reload the library
+static constexpr int kUnloadGraceMs = 60000;
+
 WidgetManager::WidgetManager(PluginLoader& pluginLoader, QObject* parent)
-    : QObject(parent), pluginLoader_(pluginLoader) {}
+    : QObject(parent), pluginLoader_(pluginLoader) {
+    index_.setReadOnly(pluginLoader.isReadOnly());
+}
+
+void WidgetManager::setIsolated(bool isolated) {
+    isolated_ = isolated;
+    index_.setIsolated(isolated);
+}
 
 void WidgetManager::loadPlugins() {
-    auto loaded = pluginLoader_.loadAll();
-    for (auto* widget : loaded) {
-        if (std::find(widgets_.begin(), widgets_.end(), widget) != widgets_.end()) {
+    index_.scan(pluginLoader_);
+    // Plugins that left the index. Cards may still hold an instance or a remote
+    // stand-in; those states stay until the cards are gone.
+    for (auto it = states_.begin(); it != states_.end();) {
+        if (index_.find(it.key()) || it->refs > 0 || it->remote) {
+            ++it;
+            continue;
+        }
+        if (it->instance) {
+            pluginLoader_.unload(pluginLoader_.filePath(it->instance));
+            emit widgetUnloaded(it.key());
+        }
+        it = states_.erase(it);
+    }
+    for (const auto& info : index_.plugins()) {
+        PluginState& state = states_[info.name];
+        if (state.instance || !pluginLoader_.isLoaded(info.filePath)) {
             continue;
         }
-        widgets_.push_back(widget);
+        // Loaded by the index to read its metadata; unloaded again unless a card takes it up
+        state.instance = pluginLoader_.load(info.filePath);
+        emit widgetLoaded(state.instance);
+        scheduleUnload(info.name);
+    }
+}
+
+void WidgetManager::addBuiltin(IWidget* widget) {
+    const auto meta = widget->metadata();
+    PluginInfo info;
+    info.name = meta.name;
+    info.description = meta.description;
+    info.defaultSize = meta.defaultSize;
+    info.minSize = meta.minSize;
+    info.maxSize = meta.maxSize;
+    if (index_.add(info)) {
+        states_[info.name].instance = widget;
         emit widgetLoaded(widget);
     }
 }
 
-const std::vector<IWidget*>& WidgetManager::widgets() const {
-    return widgets_;
+const std::vector<PluginInfo>& WidgetManager::plugins() const {
+    return index_.plugins();
+}
+
+const PluginInfo* WidgetManager::pluginInfo(const QString& name) const {
+    return index_.find(name);
 }
 
-IWidget* WidgetManager::findByName(const QString& name) const {
-    for (auto* widget : widgets_) {
-        if (widget->metadata().name == name) {
-            return widget;
+bool WidgetManager::isLoaded(const QString& name) const {
+    auto it = states_.constFind(name);
+    return it != states_.cend() && it->instance;
+}
+
+IWidget* WidgetManager::findByName(const QString& name) {
+    auto it = states_.find(name);
+    PluginInfo* info = index_.find(name);
+    if (it == states_.end() || !info) {
+        return nullptr;
+    }
+    if (isolated_ && !it->instance) {
+        if (!it->remote) {
+            it->remote = std::make_shared<RemotePlugin>(*info);
+        }
+        return it->remote.get();
+    }
+    if (!it->instance) {
+        it->instance = pluginLoader_.load(info->filePath);
+        if (!it->instance) {
+            return nullptr;
+        }
+        info->loadTimeNs = pluginLoader_.loadTimesNs().value(info->filePath);
+        emit widgetLoaded(it->instance);
+        if (it->refs == 0) {
+            scheduleUnload(name);
+        }
+    }
+    return it->instance;
+}
+
+void WidgetManager::setLoadBudgetMs(int ms) {
+    loadBudgetMs_ = ms;
+}
+
+bool WidgetManager::exceedsLoadBudget(const QString& name) const {
+    const PluginInfo* info = pluginInfo(name);
+    return loadBudgetMs_ > 0 && info && !isLoaded(name)
+           && pluginLoader_.health().lastLoadMs(info->filePath) > loadBudgetMs_;
+}
+
+bool WidgetManager::isQuarantined(const QString& name) const {
+    const PluginInfo* info = pluginInfo(name);
+    return info && !info->filePath.isEmpty() && pluginLoader_.health().isQuarantined(info->filePath);
+}
+
+QStringList WidgetManager::quarantinedFiles() const {
+    return pluginLoader_.health().quarantined();
+}
+
+void WidgetManager::retryQuarantined() {
+    for (const QString& filePath : quarantinedFiles()) {
+        pluginLoader_.health().lift(filePath);
+    }
+    loadPlugins();
+}
+
+QString WidgetManager::pluginFilePath(const IWidget* widget) const {
+    for (const auto& state : states_) {
+        if (state.remote && state.remote.get() == widget) {
+            return state.remote->filePath();
+        }
+    }
+    return pluginLoader_.filePath(widget);
+}
+
+void WidgetManager::retain(IWidget* widget) {
+    if (PluginState* state = stateOf(widget)) {
+        ++state->refs;
+    }
+}
+
+void WidgetManager::release(IWidget* widget) {
+    for (auto it = states_.begin(); it != states_.end(); ++it) {
+        if (widget && it->instance == widget) {
+            // The key, not metadata().name: the timer below may outlive the library
+            if (it->refs > 0 && --it->refs == 0) {
+                scheduleUnload(it.key());
+            }
+            return;
+        }
+    }
+}
+
+WidgetManager::PluginState* WidgetManager::stateOf(const IWidget* widget) {
+    if (!widget) {
+        return nullptr;
+    }
+    for (auto& state : states_) {
+        if (state.instance == widget) {
+            return &state;
         }
     }
     return nullptr;
 }
 
+void WidgetManager::scheduleUnload(const QString& name) {
+    // A newer schedule or a retain in between makes this one stale
+    const int generation = ++states_[name].idleGeneration;
+    QTimer::singleShot(kUnloadGraceMs, this,
+                       [this, name, generation]() { unloadIfIdle(name, generation); });
+}
+
+void WidgetManager::unloadIfIdle(const QString& name, int generation) {
+    auto it = states_.find(name);
+    if (it == states_.end() || !it->instance || it->refs > 0
+        || it->idleGeneration != generation) {
+        return;
+    }
+    const PluginInfo* info = pluginInfo(name);
+    if (!info || info->filePath.isEmpty()) {
+        return;  // built in, or gone from the plugin directories
+    }
+    const qint64 before = ProcessMemory::residentBytes();
+    it->instance = nullptr;
+    pluginLoader_.unload(info->filePath);
+    const qint64 after = ProcessMemory::residentBytes();
+    qInfo().noquote() << QString("Unloaded unused plugin %1: RSS %2 KiB -> %3 KiB")
+                             .arg(name)
+                             .arg(before / 1024)
+                             .arg(after / 1024);
+    emit widgetUnloaded(name);
+}
+
 }  // namespace dashboard
@@ -18,32 +18,79 @@
 #include <dashboard/IWidget.h>
 #include <dashboard/WidgetContext.h>
 
+#include "PluginIndex.h"
+
+#include <QHash>
 #include <QObject>
 #include <QString>
+#include <QStringList>
 #include <memory>
 #include <vector>
 
 namespace dashboard {
 
 class PluginLoader;
+class RemotePlugin;
 class WidgetCanvas;
 
+// Holds the widget plugins and counts the cards using each one. Libraries are
+// loaded only when a card needs them; one no card uses is unloaded again
+// after a grace period.
 class WidgetManager : public QObject {
     Q_OBJECT
 
 public:
     explicit WidgetManager(PluginLoader& pluginLoader, QObject* parent = nullptr);
 
+    // Plugins of isolated widgets are never loaded here; findByName returns a
+    // RemotePlugin built from the index. Set before loadPlugins().
+    void setIsolated(bool isolated);
+    // Indexes the plugins; loads only new or replaced libraries (see PluginIndex).
     void loadPlugins();
-    const std::vector<IWidget*>& widgets() const;
-    IWidget* findByName(const QString& name) const;
+    // Registers a plugin compiled into the executable; it is never unloaded.
+    void addBuiltin(IWidget* widget);
+    const std::vector<PluginInfo>& plugins() const;
+    const PluginInfo* pluginInfo(const QString& name) const;
+    bool isLoaded(const QString& name) const;
+    // The plugin's instance, loading its library again if it was unloaded.
+    IWidget* findByName(const QString& name);
+    QString pluginFilePath(const IWidget* widget) const;
+
+    // Plugins whose last load took longer than this are loaded after the rest
+    // of the view has painted (see RestorePipeline).
+    void setLoadBudgetMs(int ms);
+    bool exceedsLoadBudget(const QString& name) const;
+    // Libraries that took the previous start down while loading (see PluginHealth)
+    bool isQuarantined(const QString& name) const;
+    QStringList quarantinedFiles() const;
+    // Allows loading them again; plugins the index skipped because of it are added.
+    void retryQuarantined();
+
+    // One reference per card holding the plugin instance
+    void retain(IWidget* widget);
+    void release(IWidget* widget);
 
 signals:
     void widgetLoaded(IWidget* widget);
+    void widgetUnloaded(const QString& name);
 
 private:
+    struct PluginState {
+        IWidget* instance = nullptr;
+        int refs = 0;
+        int idleGeneration = 0;
+        std::shared_ptr<RemotePlugin> remote;
+    };
+
+    PluginState* stateOf(const IWidget* widget);
+    void scheduleUnload(const QString& name);
+    void unloadIfIdle(const QString& name, int generation);
+
     PluginLoader& pluginLoader_;
-    std::vector<IWidget*> widgets_;
+    PluginIndex index_;
+    QHash<QString, PluginState> states_;
+    int loadBudgetMs_ = 0;
+    bool isolated_ = false;
 };
 
 }  // namespace dashboard
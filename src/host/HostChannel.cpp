@@ -0,0 +1,74 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "HostChannel.h"
+
+#include <QDataStream>
+#include <QDeadlineTimer>
+
+namespace dashboard {
+
+HostChannel::HostChannel(QLocalSocket* socket, QObject* parent)
+    : QObject(parent), socket_(socket) {
+    connect(socket_, &QLocalSocket::readyRead, this, &HostChannel::readMessages);
+}
+
+QLocalSocket* HostChannel::socket() const {
+    return socket_;
+}
+
+void HostChannel::send(HostMessage type, const QByteArray& payload) {
+    if (socket_->state() != QLocalSocket::ConnectedState) {
+        return;
+    }
+    QDataStream out(socket_);
+    out << static_cast<quint8>(type) << payload;
+}
+
+bool HostChannel::waitFor(HostMessage type, int msecs) {
+    QDeadlineTimer deadline(msecs);
+    awaited_ = type;
+    waiting_ = true;
+    awaitedSeen_ = false;
+    socket_->flush();
+    while (!awaitedSeen_ && !deadline.hasExpired()
+           && socket_->state() == QLocalSocket::ConnectedState) {
+        if (socket_->waitForReadyRead(static_cast<int>(deadline.remainingTime()))) {
+            readMessages();
+        }
+    }
+    waiting_ = false;
+    return awaitedSeen_;
+}
+
+void HostChannel::readMessages() {
+    QDataStream in(socket_);
+    for (;;) {
+        in.startTransaction();
+        quint8 type = 0;
+        QByteArray payload;
+        in >> type >> payload;
+        if (!in.commitTransaction()) {
+            return;
+        }
+        auto message = static_cast<HostMessage>(type);
+        if (waiting_ && message == awaited_) {
+            awaitedSeen_ = true;
+        }
+        emit messageReceived(message, payload);
+    }
+}
+
+}  // namespace dashboard
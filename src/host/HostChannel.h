@@ -0,0 +1,75 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QByteArray>
+#include <QLocalSocket>
+#include <QObject>
+
+namespace dashboard {
+
+// Wire protocol between the dashboard and an out-of-process widget host.
+// Each message is a QDataStream-encoded (quint8 type, QByteArray payload) pair.
+enum class HostMessage : quint8 {
+    Hello = 1,      // host -> dashboard: helper is up and the widget was created
+    Resize,         // dashboard -> host: width, height, dpr, shared memory key
+    FrameReady,     // host -> dashboard: a new frame is in shared memory
+    Mouse,          // dashboard -> host: event type, pos, button, buttons, modifiers
+    Wheel,          // dashboard -> host: pos, pixelDelta, angleDelta, buttons, modifiers
+    Key,            // dashboard -> host: event type, key, modifiers, text, autoRepeat
+    Save,           // dashboard -> host: serialize and write widget state
+    Saved,          // host -> dashboard: state written to WidgetDataStore
+    Shutdown,       // dashboard -> host: exit without saving
+    PowerProfile,   // dashboard -> host: low power and frozen flags
+};
+
+// Header at the start of the shared memory segment; pixel data follows.
+struct SharedFrameHeader {
+    quint32 magic;
+    quint32 width;
+    quint32 height;
+    quint32 bytesPerLine;
+    quint64 sequence;
+};
+
+inline constexpr quint32 kSharedFrameMagic = 0x44424652;  // "DBFR"
+
+class HostChannel : public QObject {
+    Q_OBJECT
+
+public:
+    explicit HostChannel(QLocalSocket* socket, QObject* parent = nullptr);
+
+    QLocalSocket* socket() const;
+    void send(HostMessage type, const QByteArray& payload = {});
+
+    // Blocks until a message of the given type arrives or the timeout expires.
+    // Other messages received meanwhile are still dispatched.
+    bool waitFor(HostMessage type, int msecs);
+
+signals:
+    void messageReceived(HostMessage type, const QByteArray& payload);
+
+private:
+    void readMessages();
+
+    QLocalSocket* socket_;
+    HostMessage awaited_ = HostMessage::Hello;
+    bool waiting_ = false;
+    bool awaitedSeen_ = false;
+};
+
+}  // namespace dashboard
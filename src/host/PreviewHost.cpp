@@ -0,0 +1,106 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PreviewHost.h"
+
+#include "core/PluginIndex.h"
+
+#include <dashboard/IWidget.h>
+
+#include <QApplication>
+#include <QJsonDocument>
+#include <QPixmap>
+#include <QPluginLoader>
+#include <QSaveFile>
+#include <QTextStream>
+#include <QTimer>
+#include <QWidget>
+#include <qlogging.h>
+
+namespace dashboard {
+
+// Time for the widget's first timers and layouts to run before the grab
+static constexpr int kSettleMs = 300;
+
+int PreviewHost::runFromArguments(int argc, char** argv) {
+    if (argc < 5 || qstrcmp(argv[1], "--render-preview") != 0) {
+        return -1;
+    }
+    const QString pluginPath = QString::fromLocal8Bit(argv[2]);
+    const QString outputPath = QString::fromLocal8Bit(argv[3]);
+    const QList<QByteArray> size = QByteArray(argv[4]).split('x');
+    const QSize maxSize = size.size() == 2 ? QSize(size[0].toInt(), size[1].toInt()) : QSize();
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+    app.setApplicationName("Dashboard");
+    app.setOrganizationName("Dashboard");
+
+    QPluginLoader loader(pluginPath);
+    auto* plugin = qobject_cast<IWidget*>(loader.instance());
+    if (!plugin) {
+        qWarning() << "Preview: failed to load plugin:" << pluginPath << loader.errorString();
+        return 2;
+    }
+
+    QWidget* widget = plugin->createWidget(nullptr);
+    widget->resize(plugin->metadata().defaultSize);
+    widget->show();
+
+    int rc = 3;
+    QTimer::singleShot(kSettleMs, &app, [&]() {
+        QPixmap pixmap = widget->grab();
+        if (maxSize.isValid() && !maxSize.isEmpty()) {
+            pixmap = pixmap.scaled(maxSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }
+        QSaveFile file(outputPath);
+        if (file.open(QIODevice::WriteOnly) && pixmap.save(&file, "PNG") && file.commit()) {
+            rc = 0;
+        }
+        app.quit();
+    });
+    app.exec();
+    delete widget;
+    return rc;
+}
+
+int PreviewHost::describeFromArguments(int argc, char** argv) {
+    if (argc < 3 || qstrcmp(argv[1], "--describe-plugin") != 0) {
+        return -1;
+    }
+    const QString pluginPath = QString::fromLocal8Bit(argv[2]);
+
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+
+    QPluginLoader loader(pluginPath);
+    auto* plugin = qobject_cast<IWidget*>(loader.instance());
+    if (!plugin) {
+        qWarning() << "Describe: failed to load plugin:" << pluginPath << loader.errorString();
+        return 2;
+    }
+    const auto meta = plugin->metadata();
+    PluginInfo info;
+    info.fileId = PluginIndex::fileId(pluginPath);
+    info.name = meta.name;
+    info.description = meta.description;
+    info.defaultSize = meta.defaultSize;
+    info.minSize = meta.minSize;
+    info.maxSize = meta.maxSize;
+    QTextStream(stdout) << QJsonDocument(PluginIndex::toJson(info)).toJson(QJsonDocument::Compact);
+    return 0;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,36 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+namespace dashboard {
+
+// Entry point of the preview helper (`dashboard --render-preview`). Creates a
+// plugin's widget offscreen at its default size, lets it settle briefly and
+// writes a scaled PNG. Runs in its own process so the dashboard neither loads
+// the library nor blocks while the widget starts up.
+class PreviewHost {
+public:
+    // Parses `--render-preview <plugin> <output.png> <W>x<H>` and renders.
+    // Returns -1 when argv does not request preview mode.
+    static int runFromArguments(int argc, char** argv);
+
+    // Parses `--describe-plugin <plugin>` and prints the plugin's metadata as
+    // plugin-index JSON, so isolated plugins are never loaded by the dashboard.
+    // Returns -1 when argv does not request it.
+    static int describeFromArguments(int argc, char** argv);
+};
+
+}  // namespace dashboard
@@ -0,0 +1,297 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "WidgetHost.h"
+
+#include "core/IdleScheduler.h"
+#include "core/ImageCache.h"
+#include "core/PowerProfile.h"
+#include "core/TaskExecutor.h"
+#include "core/WidgetDataStore.h"
+
+#include <QApplication>
+#include <QDataStream>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QVBoxLayout>
+#include <QWheelEvent>
+#include <dashboard/IWidget.h>
+
+namespace dashboard {
+
+static constexpr int kRenderCoalesceMs = 16;
+
+WidgetHost::WidgetHost(const QString& pluginPath, const QString& instanceId,
+                       const QString& serverName, QObject* parent)
+    : QObject(parent),
+      pluginPath_(pluginPath),
+      instanceId_(instanceId),
+      serverName_(serverName),
+      loader_(pluginPath) {
+    renderTimer_.setSingleShot(true);
+    renderTimer_.setInterval(kRenderCoalesceMs);
+    connect(&renderTimer_, &QTimer::timeout, this, &WidgetHost::render);
+}
+
+int WidgetHost::runFromArguments(int argc, char** argv) {
+    QString pluginPath, instanceId, serverName;
+    bool hostMode = false;
+    for (int i = 1; i < argc; ++i) {
+        const QByteArray arg(argv[i]);
+        const bool hasValue = i + 1 < argc;
+        if (arg == "--widget-host" && hasValue) {
+            hostMode = true;
+            pluginPath = QString::fromLocal8Bit(argv[++i]);
+        } else if (arg == "--instance" && hasValue) {
+            instanceId = QString::fromLocal8Bit(argv[++i]);
+        } else if (arg == "--server" && hasValue) {
+            serverName = QString::fromLocal8Bit(argv[++i]);
+        }
+    }
+    if (!hostMode) {
+        return -1;
+    }
+
+    // The widget never appears on screen; all output goes through shared memory.
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+    QApplication app(argc, argv);
+    // Same names as DashboardApp so WidgetDataStore resolves to the same directory
+    app.setApplicationName("Dashboard");
+    app.setOrganizationName("Dashboard");
+
+    WidgetHost host(pluginPath, instanceId, serverName);
+    return host.run();
+}
+
+int WidgetHost::run() {
+    if (!loadPlugin()) {
+        return 2;
+    }
+
+    socket_.connectToServer(serverName_);
+    if (!socket_.waitForConnected(5000)) {
+        qWarning() << "Widget host could not connect to" << serverName_ << socket_.errorString();
+        return 3;
+    }
+    channel_ = new HostChannel(&socket_, this);
+    connect(channel_, &HostChannel::messageReceived, this, &WidgetHost::onMessage);
+    connect(&socket_, &QLocalSocket::disconnected, qApp, &QCoreApplication::quit);
+
+    // Deserialize before createWidget, matching DashboardWindow::restoreLayout
+    QJsonObject data = WidgetDataStore::load(instanceId_);
+    if (!data.isEmpty()) {
+        plugin_->deserialize(data);
+    }
+
+    container_ = new QWidget;
+    auto* layout = new QVBoxLayout(container_);
+    layout->setContentsMargins(0, 0, 0, 0);
+    content_ = plugin_->createWidget(container_);
+    layout->addWidget(content_);
+    // Same contract as in-process cards (see WidgetCanvas::createContent)
+    IdleScheduler idleScheduler;
+    content_->setProperty(IdleScheduler::kSchedulerProperty,
+                          QVariant::fromValue<QObject*>(&idleScheduler));
+    TaskExecutor executor;
+    executor.setPoolProperties(content_);
+    // Shares the disk tier with the dashboard, not the decoded images
+    ImageCache imageCache;
+    content_->setProperty(ImageCache::kCacheProperty, QVariant::fromValue<QObject*>(&imageCache));
+    container_->installEventFilter(this);
+    container_->show();
+
+    channel_->send(HostMessage::Hello);
+
+    int rc = qApp->exec();
+    // Work the plugin deferred still runs before the helper exits, as in DashboardWindow
+    idleScheduler.flush();
+    delete container_;
+    return rc;
+}
+
+bool WidgetHost::loadPlugin() {
+    QObject* instance = loader_.instance();
+    plugin_ = qobject_cast<IWidget*>(instance);
+    if (!plugin_) {
+        qWarning() << "Widget host failed to load plugin:" << pluginPath_ << loader_.errorString();
+        return false;
+    }
+    return true;
+}
+
+void WidgetHost::onMessage(HostMessage type, const QByteArray& payload) {
+    switch (type) {
+        case HostMessage::Resize:   applyResize(payload); break;
+        case HostMessage::Mouse:    replayMouse(payload); break;
+        case HostMessage::Wheel:    replayWheel(payload); break;
+        case HostMessage::Key:      replayKey(payload); break;
+        case HostMessage::Save:     saveState(); break;
+        case HostMessage::Shutdown: qApp->quit(); break;
+        case HostMessage::PowerProfile: applyPowerProfile(payload); break;
+        default: break;
+    }
+}
+
+bool WidgetHost::eventFilter(QObject* watched, QEvent* event) {
+    // Any update inside the container ends up as an UpdateRequest on the top level
+    if (watched == container_ && !rendering_
+        && (event->type() == QEvent::UpdateRequest || event->type() == QEvent::LayoutRequest)) {
+        scheduleRender();
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+void WidgetHost::applyResize(const QByteArray& payload) {
+    QDataStream in(payload);
+    QSize size;
+    QString key;
+    in >> size >> dpr_ >> key;
+
+    // The dashboard reuses a segment while the frame fits in it
+    if (!shared_.isAttached() || shared_.key() != key) {
+        if (shared_.isAttached()) {
+            shared_.detach();
+        }
+        shared_.setKey(key);
+        if (!shared_.attach()) {
+            qWarning() << "Widget host could not attach frame buffer:" << shared_.errorString();
+            return;
+        }
+    }
+    container_->resize(size);
+    render();
+}
+
+void WidgetHost::scheduleRender() {
+    if (!renderTimer_.isActive() && !pause_.isPaused()) {
+        renderTimer_.start();
+    }
+}
+
+void WidgetHost::render() {
+    if (!shared_.isAttached() || !shared_.lock()) {
+        return;
+    }
+    auto* header = static_cast<SharedFrameHeader*>(shared_.data());
+    if (header->magic == kSharedFrameMagic) {
+        auto* pixels = static_cast<uchar*>(shared_.data()) + sizeof(SharedFrameHeader);
+        QImage image(pixels, int(header->width), int(header->height), int(header->bytesPerLine),
+                     QImage::Format_ARGB32_Premultiplied);
+        image.setDevicePixelRatio(dpr_);
+        image.fill(Qt::transparent);
+
+        rendering_ = true;
+        container_->render(&image, QPoint(), QRegion(), QWidget::DrawChildren);
+        rendering_ = false;
+
+        header->sequence = ++sequence_;
+    }
+    shared_.unlock();
+    channel_->send(HostMessage::FrameReady);
+}
+
+void WidgetHost::replayMouse(const QByteArray& payload) {
+    QDataStream in(payload);
+    int type = 0, button = 0, buttons = 0, modifiers = 0;
+    QPointF pos;
+    in >> type >> pos >> button >> buttons >> modifiers;
+
+    auto eventType = static_cast<QEvent::Type>(type);
+    QWidget* target = mouseGrabber_;
+    if (!target) {
+        target = container_->childAt(pos.toPoint());
+        if (!target) {
+            target = container_;
+        }
+    }
+    if (eventType == QEvent::MouseButtonPress) {
+        mouseGrabber_ = target;
+        container_->activateWindow();
+        if (target->focusPolicy() & Qt::ClickFocus) {
+            target->setFocus(Qt::MouseFocusReason);
+        }
+    } else if (eventType == QEvent::MouseButtonRelease) {
+        mouseGrabber_ = nullptr;
+    }
+
+    QPointF local = target->mapFrom(container_, pos);
+    QMouseEvent mouseEvent(eventType, local, target->mapToGlobal(local),
+                           static_cast<Qt::MouseButton>(button),
+                           Qt::MouseButtons(buttons), Qt::KeyboardModifiers(modifiers));
+    QApplication::sendEvent(target, &mouseEvent);
+}
+
+void WidgetHost::replayWheel(const QByteArray& payload) {
+    QDataStream in(payload);
+    QPointF pos;
+    QPoint pixelDelta, angleDelta;
+    int buttons = 0, modifiers = 0;
+    in >> pos >> pixelDelta >> angleDelta >> buttons >> modifiers;
+
+    QWidget* target = container_->childAt(pos.toPoint());
+    if (!target) {
+        target = container_;
+    }
+    QPointF local = target->mapFrom(container_, pos);
+    QWheelEvent wheelEvent(local, target->mapToGlobal(local), pixelDelta, angleDelta,
+                           Qt::MouseButtons(buttons), Qt::KeyboardModifiers(modifiers),
+                           Qt::NoScrollPhase, false);
+    QApplication::sendEvent(target, &wheelEvent);
+}
+
+void WidgetHost::replayKey(const QByteArray& payload) {
+    QDataStream in(payload);
+    int type = 0, key = 0, modifiers = 0;
+    QString text;
+    bool autoRepeat = false;
+    in >> type >> key >> modifiers >> text >> autoRepeat;
+
+    QWidget* target = QApplication::focusWidget();
+    if (!target) {
+        target = container_;
+    }
+    QKeyEvent keyEvent(static_cast<QEvent::Type>(type), key, Qt::KeyboardModifiers(modifiers),
+                       text, autoRepeat);
+    QApplication::sendEvent(target, &keyEvent);
+}
+
+void WidgetHost::applyPowerProfile(const QByteArray& payload) {
+    QDataStream in(payload);
+    bool lowPower = false;
+    bool frozen = false;
+    in >> lowPower >> frozen;
+    // Same property the in-process canvas sets, and frames go out at the capped rate
+    content_->setProperty(PowerProfile::kLowPowerProperty, lowPower);
+    renderTimer_.setInterval(lowPower ? PowerProfile::kLowPowerFrameIntervalMs
+                                      : kRenderCoalesceMs);
+    // The dashboard paints its snapshot of a frozen card; catch up once it thaws
+    if (frozen) {
+        pause_.pause(content_);
+        renderTimer_.stop();
+    } else if (pause_.isPaused()) {
+        pause_.resume();
+        scheduleRender();
+    }
+}
+
+void WidgetHost::saveState() {
+    QJsonObject data = plugin_->serialize();
+    if (!data.isEmpty()) {
+        WidgetDataStore::save(instanceId_, data);
+    }
+    channel_->send(HostMessage::Saved);
+}
+
+}  // namespace dashboard
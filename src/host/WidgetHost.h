@@ -0,0 +1,85 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "HostChannel.h"
+#include "core/ContentPause.h"
+
+#include <QImage>
+#include <QLocalSocket>
+#include <QObject>
+#include <QPluginLoader>
+#include <QPointer>
+#include <QSharedMemory>
+#include <QTimer>
+#include <QWidget>
+
+namespace dashboard {
+
+class IWidget;
+
+// Entry point of the out-of-process widget host (`dashboard --widget-host`).
+// Loads a single plugin, creates its widget offscreen, renders it into the
+// shared memory segment provided by the dashboard and replays forwarded input.
+class WidgetHost : public QObject {
+    Q_OBJECT
+
+public:
+    WidgetHost(const QString& pluginPath, const QString& instanceId, const QString& serverName,
+               QObject* parent = nullptr);
+
+    int run();
+
+    // Parses `--widget-host <plugin> --instance <id> --server <name>` and runs the host.
+    // Returns -1 when argv does not request host mode.
+    static int runFromArguments(int argc, char** argv);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    bool loadPlugin();
+    void onMessage(HostMessage type, const QByteArray& payload);
+    void applyResize(const QByteArray& payload);
+    void replayMouse(const QByteArray& payload);
+    void replayWheel(const QByteArray& payload);
+    void replayKey(const QByteArray& payload);
+    void saveState();
+    void applyPowerProfile(const QByteArray& payload);
+    void scheduleRender();
+    void render();
+
+    QString pluginPath_;
+    QString instanceId_;
+    QString serverName_;
+
+    QPluginLoader loader_;
+    IWidget* plugin_ = nullptr;
+    QWidget* container_ = nullptr;
+    QWidget* content_ = nullptr;
+    QLocalSocket socket_;
+    HostChannel* channel_ = nullptr;
+    QSharedMemory shared_;
+    qreal dpr_ = 1.0;
+    quint64 sequence_ = 0;
+
+    QTimer renderTimer_;
+    ContentPause pause_;  // while the card is frozen: no timers, no frames
+    bool rendering_ = false;
+    QPointer<QWidget> mouseGrabber_;
+};
+
+}  // namespace dashboard
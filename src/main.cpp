@@ -14,17 +14,54 @@
 // along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 #include "app/DashboardApp.h"
+#include "app/HeadlessRenderer.h"
+#include "app/SingleInstance.h"
+#include "host/PreviewHost.h"
+#include "host/WidgetHost.h"
 
 #include <QLockFile>
 #include <QStandardPaths>
+#include <QThread>
 
 int main(int argc, char* argv[]) {
-    // Single-instance guard
+    // Out-of-process widget host; not subject to the single-instance guard
+    if (int rc = dashboard::WidgetHost::runFromArguments(argc, argv); rc >= 0) {
+        return rc;
+    }
+    if (int rc = dashboard::PreviewHost::runFromArguments(argc, argv); rc >= 0) {
+        return rc;
+    }
+    if (int rc = dashboard::PreviewHost::describeFromArguments(argc, argv); rc >= 0) {
+        return rc;
+    }
+
+    // Headless rendering has no window to raise and never hands off to a GUI instance
+    const auto launch = dashboard::HeadlessRenderer::prepare(argc, argv);
+    if (launch == dashboard::HeadlessRenderer::Launch::UsageError) {
+        return 2;
+    }
+    const bool headless = launch == dashboard::HeadlessRenderer::Launch::Headless;
+
+    // A running instance takes over this launch's arguments
+    if (!headless && dashboard::SingleInstance::forward(argc, argv)) {
+        return 0;
+    }
+
+    // Single-instance guard. Headless runs may run next to the GUI instance, so
+    // they take no lock; they keep plugin health, the plugin index and the stall
+    // log read-only instead (see DashboardApp).
     QString lockPath =
         QStandardPaths::writableLocation(QStandardPaths::TempLocation) + "/dashboard.lock";
     QLockFile lockFile(lockPath);
 
-    if (!lockFile.tryLock(100)) {
+    if (!headless && !lockFile.tryLock(0)) {
+        // Another instance is starting up; give it a moment to open its socket
+        for (int attempt = 0; attempt < 20; ++attempt) {
+            QThread::msleep(100);
+            if (dashboard::SingleInstance::forward(argc, argv)) {
+                return 0;
+            }
+        }
         qWarning("Another instance of Dashboard is already running.");
         return 1;
     }
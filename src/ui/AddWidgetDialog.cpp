@@ -15,18 +15,23 @@
 
 #include "AddWidgetDialog.h"
 
+#include "PreviewCache.h"
 #include "core/WidgetManager.h"
 
 #include <QDialogButtonBox>
 #include <QLabel>
+#include <QPainter>
 #include <QVBoxLayout>
 
 namespace dashboard {
 
-AddWidgetDialog::AddWidgetDialog(WidgetManager& widgetManager, QWidget* parent)
-    : QDialog(parent), widgetManager_(widgetManager) {
+static constexpr QSize kIconSize(96, 72);
+
+AddWidgetDialog::AddWidgetDialog(WidgetManager& widgetManager, PreviewCache& previews,
+                                 QWidget* parent)
+    : QDialog(parent), widgetManager_(widgetManager), previews_(previews) {
     setWindowTitle("Add Widget");
-    setMinimumSize(350, 300);
+    setMinimumSize(420, 360);
     setupUi();
 }
 
@@ -37,14 +42,24 @@ void AddWidgetDialog::setupUi() {
 
     listWidget_ = new QListWidget(this);
     listWidget_->setSelectionMode(QAbstractItemView::ExtendedSelection);
+    listWidget_->setIconSize(kIconSize);
 
-    const auto& widgets = widgetManager_.widgets();
-    for (auto* widget : widgets) {
-        auto meta = widget->metadata();
+    // Cached previews show at once; missing ones are rendered by helper processes
+    for (const auto& info : widgetManager_.plugins()) {
         auto* item = new QListWidgetItem(listWidget_);
-        item->setText(QString("%1  —  %2").arg(meta.name, meta.description));
-        item->setData(Qt::UserRole, QVariant::fromValue(reinterpret_cast<quintptr>(widget)));
+        item->setText(QString("%1  —  %2").arg(info.name, info.description));
+        item->setData(Qt::UserRole, info.name);
+        setPreview(item, previews_.preview(info));
     }
+    connect(&previews_, &PreviewCache::previewReady, this,
+            [this](const QString& pluginName, const QPixmap& pixmap) {
+                for (int i = 0; i < listWidget_->count(); ++i) {
+                    QListWidgetItem* item = listWidget_->item(i);
+                    if (item->data(Qt::UserRole).toString() == pluginName) {
+                        setPreview(item, pixmap);
+                    }
+                }
+            });
 
     // Select first item by default
     if (listWidget_->count() > 0) {
@@ -63,11 +78,28 @@ void AddWidgetDialog::setupUi() {
     connect(buttons, &QDialogButtonBox::rejected, this, &QDialog::reject);
 }
 
-std::vector<IWidget*> AddWidgetDialog::selectedWidgets() const {
-    std::vector<IWidget*> result;
+void AddWidgetDialog::setPreview(QListWidgetItem* item, const QPixmap& pixmap) {
+    // Every icon gets the full icon size so names line up while previews arrive
+    const qreal dpr = devicePixelRatioF();
+    QPixmap icon(kIconSize * dpr);
+    icon.setDevicePixelRatio(dpr);
+    icon.fill(Qt::transparent);
+    if (!pixmap.isNull()) {
+        QPainter painter(&icon);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        QSize size = pixmap.size().scaled(kIconSize, Qt::KeepAspectRatio);
+        painter.drawPixmap(QRect(QPoint((kIconSize.width() - size.width()) / 2,
+                                        (kIconSize.height() - size.height()) / 2),
+                                 size),
+                           pixmap);
+    }
+    item->setIcon(QIcon(icon));
+}
+
+QStringList AddWidgetDialog::selectedPlugins() const {
+    QStringList result;
     for (auto* item : listWidget_->selectedItems()) {
-        auto ptr = item->data(Qt::UserRole).value<quintptr>();
-        result.push_back(reinterpret_cast<IWidget*>(ptr));
+        result.append(item->data(Qt::UserRole).toString());
     }
     return result;
 }
@@ -15,28 +15,31 @@
 
 #pragma once
 
-#include <dashboard/IWidget.h>
-
 #include <QDialog>
 #include <QListWidget>
-#include <vector>
+#include <QStringList>
 
 namespace dashboard {
 
+class PreviewCache;
 class WidgetManager;
 
 class AddWidgetDialog : public QDialog {
     Q_OBJECT
 
 public:
-    explicit AddWidgetDialog(WidgetManager& widgetManager, QWidget* parent = nullptr);
+    AddWidgetDialog(WidgetManager& widgetManager, PreviewCache& previews,
+                    QWidget* parent = nullptr);
 
-    std::vector<IWidget*> selectedWidgets() const;
+    // Names of the selected plugins; their libraries may not be loaded.
+    QStringList selectedPlugins() const;
 
 private:
     void setupUi();
+    void setPreview(QListWidgetItem* item, const QPixmap& pixmap);
 
     WidgetManager& widgetManager_;
+    PreviewCache& previews_;
     QListWidget* listWidget_;
 };
 
@@ -0,0 +1,312 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "CanvasOverview.h"
+
+#include "Theme.h"
+#include "WidgetCanvas.h"
+#include "WidgetFrame.h"
+#include "core/PerfMonitor.h"
+
+#include <QApplication>
+#include <QDynamicPropertyChangeEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QWheelEvent>
+#include <algorithm>
+#include <cmath>
+
+namespace dashboard {
+
+static constexpr double kMinZoom = 0.05;
+static constexpr double kMaxZoom = 0.9;
+static constexpr double kWheelStep = 1.25;
+static constexpr int kRefreshIntervalMs = 1000;
+static constexpr int kCatchUpIntervalMs = 16;
+static constexpr int kRefreshBudgetMs = 8;
+static constexpr qint64 kMaxSnapshotAgeMs = 5000;
+
+CanvasOverview::CanvasOverview(WidgetCanvas& canvas, QWidget* parent)
+    : QWidget(parent), canvas_(canvas) {
+    setAttribute(Qt::WA_OpaquePaintEvent);
+    setCursor(Qt::OpenHandCursor);
+    clock_.start();
+
+    refreshTimer_.setSingleShot(true);
+    connect(&refreshTimer_, &QTimer::timeout, this, &CanvasOverview::refreshSome);
+}
+
+double CanvasOverview::zoom() const {
+    return zoom_;
+}
+
+void CanvasOverview::setZoom(double zoom, const QPointF& anchor) {
+    const QPointF canvasPoint = mapToCanvas(anchor);
+    zoom_ = qBound(kMinZoom, zoom, kMaxZoom);
+    offset_ = anchor - canvasPoint * zoom_;
+    rebuildBackground();
+    update();
+    emit zoomChanged(zoom_);
+}
+
+void CanvasOverview::centerOn(const QPointF& canvasPoint, double zoom) {
+    zoom_ = qBound(kMinZoom, zoom, kMaxZoom);
+    offset_ = QRectF(rect()).center() - canvasPoint * zoom_;
+    rebuildBackground();
+    update();
+    emit zoomChanged(zoom_);
+}
+
+QPointF CanvasOverview::mapToCanvas(const QPointF& pos) const {
+    return (pos - offset_) / zoom_;
+}
+
+quint64 CanvasOverview::generationOf(WidgetFrame* frame) const {
+    // Every paint inside a card is counted per instance. It only moves while the
+    // live canvas is shown, so it catches changes made between two overviews.
+    auto* monitor = PerfMonitor::instance();
+    if (!monitor || frame->widgetId().isEmpty()) {
+        return 0;
+    }
+    const InstanceStats* stats = monitor->stats(frame, frame->pluginName(), frame->widgetId());
+    return stats->calls[int(PluginCall::Paint)].count;
+}
+
+CanvasOverview::Entry& CanvasOverview::entryFor(WidgetFrame* frame) {
+    Entry& entry = entries_[frame];
+    if (entry.frame != frame) {
+        // New card, or a recycled address of a deleted one
+        entry = Entry();
+        entry.frame = frame;
+    }
+    QWidget* content = frame->contentWidget();
+    if (entry.content != content) {
+        // Loaded, unloaded or replaced since the last capture
+        entry.content = content;
+        entry.dirty = !entry.lod.isEmpty();
+        if (content) {
+            content->installEventFilter(this);
+        }
+    }
+    return entry;
+}
+
+void CanvasOverview::capture(Entry& entry) {
+    QPixmap pixmap = entry.frame->grab();
+    entry.lod.setBase(pixmap, generationOf(entry.frame));
+    entry.capturedMs = clock_.elapsed();
+    entry.dirty = false;
+    if (entry.content && entry.content->property(kContentChangedProperty).toBool()) {
+        entry.content->setProperty(kContentChangedProperty, false);
+    }
+}
+
+void CanvasOverview::markDirty(QObject* content) {
+    for (auto& entry : entries_) {
+        if (entry.content == content) {
+            entry.dirty = true;
+        }
+    }
+    if (isVisible() && refreshTimer_.remainingTime() > kCatchUpIntervalMs) {
+        refreshTimer_.start(kCatchUpIntervalMs);
+    }
+}
+
+void CanvasOverview::refreshSome() {
+    QElapsedTimer budget;
+    budget.start();
+
+    // Drop entries of deleted cards
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        it = it->frame ? std::next(it) : entries_.erase(it);
+    }
+
+    // Missing snapshots first, then the oldest stale one, within a small budget per pass
+    bool missing = false;
+    for (auto* frame : canvas_.frames()) {
+        Entry& entry = entryFor(frame);
+        if (!entry.lod.isEmpty()) {
+            continue;
+        }
+        if (budget.elapsed() >= kRefreshBudgetMs) {
+            missing = true;
+            break;
+        }
+        capture(entry);
+    }
+
+    // Then changed cards, oldest first, as many as the budget allows
+    QList<Entry*> changed;
+    for (auto& entry : entries_) {
+        if (!entry.lod.isEmpty()
+            && (entry.dirty || entry.lod.generation() != generationOf(entry.frame))) {
+            changed.append(&entry);
+        }
+    }
+    std::sort(changed.begin(), changed.end(),
+              [](Entry* a, Entry* b) { return a->capturedMs < b->capturedMs; });
+    int next = 0;
+    while (next < changed.size() && budget.elapsed() < kRefreshBudgetMs) {
+        capture(*changed.at(next++));
+    }
+    const bool behind = missing || next < changed.size();
+
+    // Widgets that never report changes still come current slowly
+    if (changed.isEmpty() && budget.elapsed() < kRefreshBudgetMs) {
+        Entry* oldest = nullptr;
+        const qint64 now = clock_.elapsed();
+        for (auto& entry : entries_) {
+            if (now - entry.capturedMs > kMaxSnapshotAgeMs
+                && (!oldest || entry.capturedMs < oldest->capturedMs)) {
+                oldest = &entry;
+            }
+        }
+        if (oldest) {
+            capture(*oldest);
+        }
+    }
+
+    update();
+    if (isVisible()) {
+        refreshTimer_.start(behind ? kCatchUpIntervalMs : kRefreshIntervalMs);
+    }
+}
+
+void CanvasOverview::rebuildBackground() {
+    QSize size = (QSizeF(canvas_.size()) * zoom_).toSize();
+    if (size.isEmpty()) {
+        background_ = QPixmap();
+        return;
+    }
+    const qreal dpr = devicePixelRatioF();
+    background_ = QPixmap(size * dpr);
+    background_.setDevicePixelRatio(dpr);
+    QPainter painter(&background_);
+    canvas_.paintBackground(painter, QRect(QPoint(), size));
+}
+
+void CanvasOverview::paintEvent(QPaintEvent* /*event*/) {
+    const Theme& theme = Theme::current();
+    QPainter painter(this);
+    painter.fillRect(rect(), theme.window);
+    painter.drawPixmap(offset_, background_);
+    painter.setRenderHint(QPainter::SmoothPixmapTransform);
+
+    const QRectF view = rect();
+    const qreal dpr = devicePixelRatioF();
+    const qreal radius = theme.cardRadius * zoom_;
+    for (auto* frame : canvas_.frames()) {
+        QRectF target(offset_ + QPointF(frame->pos()) * zoom_, QSizeF(frame->size()) * zoom_);
+        if (!target.intersects(view)) {
+            continue;
+        }
+        Entry& entry = entryFor(frame);
+        if (entry.lod.isEmpty()) {
+            painter.setPen(theme.cardBorder);
+            painter.setBrush(theme.surface);
+            painter.drawRoundedRect(target, radius, radius);
+            continue;
+        }
+        const QPixmap& pixmap = entry.lod.level(int(std::ceil(target.width() * dpr)));
+        painter.drawPixmap(target, pixmap, QRectF(pixmap.rect()));
+    }
+}
+
+void CanvasOverview::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton) {
+        pressPos_ = event->position().toPoint();
+        pressOffset_ = offset_;
+        panning_ = false;
+    }
+}
+
+void CanvasOverview::mouseMoveEvent(QMouseEvent* event) {
+    if (!(event->buttons() & Qt::LeftButton)) {
+        return;
+    }
+    QPoint delta = event->position().toPoint() - pressPos_;
+    if (!panning_ && delta.manhattanLength() >= QApplication::startDragDistance()) {
+        panning_ = true;
+        setCursor(Qt::ClosedHandCursor);
+    }
+    if (panning_) {
+        offset_ = pressOffset_ + delta;
+        update();
+    }
+}
+
+void CanvasOverview::mouseReleaseEvent(QMouseEvent* event) {
+    if (event->button() != Qt::LeftButton) {
+        return;
+    }
+    if (panning_) {
+        panning_ = false;
+        setCursor(Qt::OpenHandCursor);
+    } else {
+        // A click zooms back in on that spot
+        emit zoomInRequested(mapToCanvas(event->position()));
+    }
+}
+
+void CanvasOverview::wheelEvent(QWheelEvent* event) {
+    const int steps = event->angleDelta().y();
+    if (steps == 0) {
+        return;
+    }
+    double zoom = steps > 0 ? zoom_ * kWheelStep : zoom_ / kWheelStep;
+    if (zoom > kMaxZoom) {
+        emit zoomInRequested(mapToCanvas(event->position()));
+    } else {
+        setZoom(zoom, event->position());
+    }
+    event->accept();
+}
+
+void CanvasOverview::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    rebuildBackground();
+    refreshSome();
+}
+
+void CanvasOverview::hideEvent(QHideEvent* event) {
+    QWidget::hideEvent(event);
+    refreshTimer_.stop();
+    // Keep what the current zoom draws and drop the full-resolution grabs;
+    // the next show repaints from these until the cards are recaptured
+    const qreal dpr = devicePixelRatioF();
+    for (auto& entry : entries_) {
+        if (entry.frame) {
+            entry.lod.trim(int(std::ceil(entry.frame->width() * zoom_ * dpr)));
+            entry.capturedMs = -1;
+        }
+    }
+}
+
+void CanvasOverview::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    update();
+}
+
+bool CanvasOverview::eventFilter(QObject* watched, QEvent* event) {
+    if (event->type() == QEvent::DynamicPropertyChange
+        && static_cast<QDynamicPropertyChangeEvent*>(event)->propertyName()
+               == kContentChangedProperty
+        && watched->property(kContentChangedProperty).toBool()) {
+        markDirty(watched);
+    }
+    return QWidget::eventFilter(watched, event);
+}
+
+}  // namespace dashboard
@@ -0,0 +1,101 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "LodCache.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QPointer>
+#include <QTimer>
+#include <QWidget>
+
+namespace dashboard {
+
+class WidgetCanvas;
+class WidgetFrame;
+
+// Zoomed-out view of the whole canvas. Cards are drawn from downscaled
+// snapshots (LodCache) instead of live widgets, so panning and zooming cost
+// one drawPixmap per visible card. Snapshots are refreshed a few at a time
+// while the overview is shown: cards whose content changed first, then the
+// oldest one at a low rate.
+//
+// The live canvas is hidden meanwhile, so its widgets do not paint. A widget
+// whose content changes then sets kContentChangedProperty to true on its
+// content widget; the overview recaptures the card and clears it again.
+class CanvasOverview : public QWidget {
+    Q_OBJECT
+
+public:
+    static constexpr const char* kContentChangedProperty = "dashboardContentChanged";
+
+    explicit CanvasOverview(WidgetCanvas& canvas, QWidget* parent = nullptr);
+
+    double zoom() const;
+    // Zooms so the canvas point under anchor (overview coordinates) stays put.
+    void setZoom(double zoom, const QPointF& anchor);
+    // Shows the canvas area centered on canvasPoint at the given zoom.
+    void centerOn(const QPointF& canvasPoint, double zoom);
+    QPointF mapToCanvas(const QPointF& pos) const;
+
+signals:
+    // Asks the window to return to 100% with canvasPoint in the middle of the view.
+    void zoomInRequested(const QPointF& canvasPoint);
+    void zoomChanged(double zoom);
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    struct Entry {
+        QPointer<WidgetFrame> frame;
+        QPointer<QWidget> content;  // watched for kContentChangedProperty
+        LodCache lod;
+        qint64 capturedMs = -1;
+        bool dirty = false;
+    };
+
+    Entry& entryFor(WidgetFrame* frame);
+    void capture(Entry& entry);
+    void refreshSome();
+    void markDirty(QObject* content);
+    quint64 generationOf(WidgetFrame* frame) const;
+    void rebuildBackground();
+
+    WidgetCanvas& canvas_;
+    QHash<WidgetFrame*, Entry> entries_;
+    double zoom_ = 0.5;
+    QPointF offset_;  // overview position of canvas (0,0)
+    QPixmap background_;
+
+    QTimer refreshTimer_;
+    QElapsedTimer clock_;
+
+    QPoint pressPos_;
+    QPointF pressOffset_;
+    bool panning_ = false;
+};
+
+}  // namespace dashboard
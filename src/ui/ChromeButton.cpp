@@ -0,0 +1,106 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ChromeButton.h"
+
+#include "Theme.h"
+
+#include <QPainter>
+
+namespace dashboard {
+
+ChromeButton::ChromeButton(const QString& text, Kind kind, QWidget* parent)
+    : QAbstractButton(parent), kind_(kind) {
+    setText(text);
+    setAttribute(Qt::WA_Hover);  // repaint on enter/leave
+    setFocusPolicy(Qt::NoFocus);
+
+    QFont f = font();
+    switch (kind_) {
+        case Kind::TitleBar:
+        case Kind::TitleBarClose:
+            f.setPixelSize(16);
+            // Fill the title bar's height; TitleBar keeps the width square
+            setSizePolicy(QSizePolicy::Fixed, QSizePolicy::Preferred);
+            break;
+        case Kind::Accent:
+            f.setPixelSize(22);
+            f.setBold(true);
+            break;
+        case Kind::Card:
+            f.setPixelSize(12);
+            f.setBold(true);
+            break;
+        case Kind::Warning:
+            f.setPixelSize(12);
+            break;
+    }
+    setFont(f);
+}
+
+QSize ChromeButton::sizeHint() const {
+    return {36, 36};
+}
+
+void ChromeButton::paintEvent(QPaintEvent* /*event*/) {
+    const Theme& theme = Theme::current();
+    const bool hovered = underMouse() && isEnabled();
+    const bool pressed = isDown();
+
+    QColor background = Qt::transparent;
+    QColor foreground = theme.mutedText;
+    switch (kind_) {
+        case Kind::TitleBar:
+            if (hovered) {
+                background = theme.hover;
+                foreground = theme.text;
+            }
+            break;
+        case Kind::TitleBarClose:
+            if (hovered) {
+                background = theme.danger;
+                foreground = Qt::white;
+            }
+            break;
+        case Kind::Accent:
+            background = pressed ? theme.accentPressed : hovered ? theme.accentHover : theme.accent;
+            foreground = Qt::white;
+            break;
+        case Kind::Card:
+            background = hovered ? theme.danger : theme.chromeButton;
+            foreground = hovered ? QColor(Qt::white) : theme.chromeButtonText;
+            break;
+        case Kind::Warning:
+            background = theme.warningBackground;
+            foreground = theme.warning;
+            break;
+    }
+
+    QPainter painter(this);
+    if (background.alpha() > 0) {
+        if (kind_ == Kind::TitleBar || kind_ == Kind::TitleBarClose) {
+            painter.fillRect(rect(), background);
+        } else {
+            painter.setRenderHint(QPainter::Antialiasing);
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(background);
+            painter.drawEllipse(rect());
+        }
+    }
+    painter.setPen(foreground);
+    painter.drawText(rect(), Qt::AlignCenter, text());
+}
+
+}  // namespace dashboard
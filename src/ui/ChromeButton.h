@@ -0,0 +1,47 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QAbstractButton>
+
+namespace dashboard {
+
+// Flat or round button for the window and card chrome, painted directly from
+// Theme::current() rather than through a per-instance style sheet.
+class ChromeButton : public QAbstractButton {
+    Q_OBJECT
+
+public:
+    enum class Kind {
+        TitleBar,       // flat, highlights on hover
+        TitleBarClose,  // flat, turns red on hover
+        Accent,         // round, accent colored (canvas "+" button)
+        Card,           // round, muted; turns red on hover (card delete button)
+        Warning,        // round warning badge
+    };
+
+    ChromeButton(const QString& text, Kind kind, QWidget* parent = nullptr);
+
+    QSize sizeHint() const override;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    Kind kind_;
+};
+
+}  // namespace dashboard
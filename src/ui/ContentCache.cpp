@@ -0,0 +1,263 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ContentCache.h"
+
+#include "CanvasOverview.h"
+#include "WidgetCanvas.h"
+#include "WidgetFrame.h"
+
+#include <QApplication>
+#include <QDynamicPropertyChangeEvent>
+#include <QGraphicsEffect>
+#include <QPainter>
+
+namespace dashboard {
+
+static constexpr int kCheckIntervalMs = 500;
+// Time a live card's content must go without painting before it rests
+static constexpr int kSettleMs = 2000;
+// Snapshots taken per check; the rest wait for later ticks
+static constexpr int kRestsPerTick = 2;
+
+// Paints the snapshot instead of the source widget tree
+class SnapshotEffect : public QGraphicsEffect {
+public:
+    SnapshotEffect(ContentCache& cache, const QPixmap& snapshot)
+        : cache_(cache), snapshot_(snapshot) {}
+
+protected:
+    void draw(QPainter* painter) override {
+        painter->drawPixmap(sourceBoundingRect(Qt::LogicalCoordinates).topLeft(), snapshot_);
+        cache_.onSnapshotPainted();
+    }
+
+private:
+    ContentCache& cache_;
+    QPixmap snapshot_;
+};
+
+static SnapshotEffect* snapshotEffect(const WidgetFrame* frame) {
+    QWidget* content = frame->contentWidget();
+    return content ? dynamic_cast<SnapshotEffect*>(content->graphicsEffect()) : nullptr;
+}
+
+static WidgetFrame* frameOf(QObject* object) {
+    for (; object; object = object->parent()) {
+        if (auto* frame = qobject_cast<WidgetFrame*>(object)) {
+            return frame;
+        }
+    }
+    return nullptr;
+}
+
+ContentCache::ContentCache(WidgetCanvas& canvas) : QObject(&canvas), canvas_(canvas) {
+    clock_.start();
+    connect(&canvas_, &WidgetCanvas::widgetAdded, this, &ContentCache::track);
+    connect(&canvas_, &WidgetCanvas::contentLoaded, this, [this](WidgetFrame* frame) {
+        cards_[frame] = Card{clock_.elapsed()};
+        watchContent(frame);
+        scheduleCheck();
+    });
+
+    checkTimer_.setInterval(kCheckIntervalMs);
+    connect(&checkTimer_, &QTimer::timeout, this, &ContentCache::checkNext);
+}
+
+void ContentCache::setEnabled(bool enabled) {
+    enabled_ = enabled;
+    if (enabled_) {
+        scheduleCheck();
+        return;
+    }
+    checkTimer_.stop();
+    for (auto* frame : canvas_.frames()) {
+        wake(frame);
+    }
+}
+
+void ContentCache::setOptIn(OptIn optIn) {
+    optIn_ = std::move(optIn);
+}
+
+void ContentCache::track(WidgetFrame* frame) {
+    cards_.insert(frame, Card{clock_.elapsed()});
+    frame->installEventFilter(this);
+    watchContent(frame);
+    connect(frame, &QObject::destroyed, this, [this, frame]() { cards_.remove(frame); });
+    scheduleCheck();
+}
+
+void ContentCache::watchContent(WidgetFrame* frame) {
+    if (QWidget* content = frame->contentWidget()) {
+        watch(content);
+    }
+}
+
+void ContentCache::watch(QObject* object) {
+    // Timers and other helper objects too: their events are what drives updates
+    object->installEventFilter(this);
+    for (QObject* child : object->findChildren<QObject*>()) {
+        child->installEventFilter(this);
+    }
+}
+
+bool ContentCache::isResting(const WidgetFrame* frame) const {
+    return snapshotEffect(frame) != nullptr;
+}
+
+void ContentCache::wake(WidgetFrame* frame) {
+    if (isResting(frame)) {
+        frame->contentWidget()->setGraphicsEffect(nullptr);
+    }
+    cards_[frame] = Card{clock_.elapsed()};
+    scheduleCheck();
+}
+
+ContentCache::Stats ContentCache::stats() const {
+    Stats stats = stats_;
+    for (const auto* frame : canvas_.frames()) {
+        stats.resting += isResting(frame) ? 1 : 0;
+    }
+    return stats;
+}
+
+bool ContentCache::isEligible(const WidgetFrame* frame) const {
+    const QWidget* content = frame->contentWidget();
+    if (!content || frame->isPlaceholder() || frame->isFrozen() || content->graphicsEffect()
+        || !content->isVisible() || frame->underMouse()
+        || !frame->geometry().intersects(canvas_.visibleRect())) {
+        return false;
+    }
+    // Don't put a card to rest while the user is typing into it
+    const QWidget* focus = QApplication::focusWidget();
+    return !focus || !content->isAncestorOf(focus);
+}
+
+void ContentCache::scheduleCheck() {
+    if (enabled_ && !checkTimer_.isActive()) {
+        checkTimer_.start();
+    }
+}
+
+void ContentCache::checkNext() {
+    const qint64 nowMs = clock_.elapsed();
+    int rested = 0;
+    bool settling = false;
+    for (WidgetFrame* frame : canvas_.frames()) {
+        if (!isEligible(frame)) {
+            continue;
+        }
+        const bool settled = nowMs - cards_[frame].lastPaintMs >= kSettleMs
+                             || (optIn_ && optIn_(frame->pluginName()));
+        if (settled && rested < kRestsPerTick) {
+            rest(frame);
+            ++rested;
+        } else {
+            settling = true;
+        }
+    }
+    // Paints, scrolling, focus and pointer changes restart the checks
+    if (!settling) {
+        checkTimer_.stop();
+    }
+}
+
+void ContentCache::rest(WidgetFrame* frame) {
+    QWidget* content = frame->contentWidget();
+    rendering_ = true;
+    const QPixmap snapshot = content->grab();
+    rendering_ = false;
+    content->setGraphicsEffect(new SnapshotEffect(*this, snapshot));
+    // Armed again for the next explicit change (see CanvasOverview)
+    if (content->property(CanvasOverview::kContentChangedProperty).toBool()) {
+        content->setProperty(CanvasOverview::kContentChangedProperty, false);
+    }
+}
+
+void ContentCache::onSnapshotPainted() {
+    ++stats_.hits;
+}
+
+void ContentCache::contentChanged(QObject* object) {
+    WidgetFrame* frame = frameOf(object);
+    if (frame && isResting(frame)) {
+        ++stats_.invalidations;
+        wake(frame);
+    }
+}
+
+bool ContentCache::eventFilter(QObject* watched, QEvent* event) {
+    auto* frame = qobject_cast<WidgetFrame*>(watched);
+    switch (event->type()) {
+    case QEvent::Enter:
+        // Live before the first click or wheel reaches the content
+        if (frame) {
+            wake(frame);
+        }
+        break;
+    case QEvent::Leave:
+    case QEvent::FocusOut:
+        scheduleCheck();
+        break;
+    case QEvent::Paint:
+        if (!frame && !rendering_) {
+            if (WidgetFrame* owner = frameOf(watched)) {
+                cards_[owner].lastPaintMs = clock_.elapsed();
+                stats_.misses += watched == owner->contentWidget() ? 1 : 0;
+            }
+            scheduleCheck();
+        }
+        break;
+    case QEvent::ChildAdded: {
+        QObject* child = static_cast<QChildEvent*>(event)->child();
+        if (!frame) {
+            watch(child);
+            if (child->isWidgetType()) {
+                contentChanged(watched);
+            }
+        }
+        break;
+    }
+    case QEvent::DynamicPropertyChange:
+        if (!frame
+            && static_cast<QDynamicPropertyChangeEvent*>(event)->propertyName()
+                   == CanvasOverview::kContentChangedProperty
+            && watched->property(CanvasOverview::kContentChangedProperty).toBool()) {
+            contentChanged(watched);
+        }
+        break;
+    case QEvent::Timer:
+    case QEvent::MetaCall:
+    case QEvent::Resize:
+    case QEvent::MouseButtonPress:
+    case QEvent::Wheel:
+    case QEvent::KeyPress:
+    case QEvent::FocusIn:
+        // Qt offers no hook for update() below a graphics effect. Content only
+        // changes on its own from timers and queued calls, so those wake the
+        // card before the widget handles them and any update() it makes lands
+        // on live content.
+        if (!frame) {
+            contentChanged(watched);
+        }
+        break;
+    default:
+        break;
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+}  // namespace dashboard
@@ -0,0 +1,92 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPixmap>
+#include <QString>
+#include <QTimer>
+#include <functional>
+
+namespace dashboard {
+
+class SnapshotEffect;
+class WidgetCanvas;
+class WidgetFrame;
+
+// Freeze-to-pixmap caching of cards whose content rarely changes. A visible
+// card whose content has not painted for a while rests: a graphics effect on
+// its content paints a snapshot instead of the widget tree, so repaints caused
+// by neighbours cost one pixmap blit. The content stays shown and keeps its
+// timers. The card wakes before anything in its content handles a timer
+// event, a queued call or input, and when it is resized, gains a child or sets
+// CanvasOverview::kContentChangedProperty. Plugins marked "cacheable" rest at
+// the first check.
+class ContentCache : public QObject {
+    Q_OBJECT
+
+public:
+    struct Stats {
+        quint64 hits = 0;           // card paints served from a snapshot
+        quint64 misses = 0;         // card paints that rendered live content
+        quint64 invalidations = 0;  // snapshots dropped because the content changed
+        int resting = 0;
+    };
+
+    using OptIn = std::function<bool(const QString& pluginName)>;
+
+    explicit ContentCache(WidgetCanvas& canvas);
+
+    void setEnabled(bool enabled);
+    void setOptIn(OptIn optIn);
+
+    bool isResting(const WidgetFrame* frame) const;
+    void wake(WidgetFrame* frame);
+    Stats stats() const;
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    friend class SnapshotEffect;
+
+    struct Card {
+        qint64 lastPaintMs = 0;
+    };
+
+    void track(WidgetFrame* frame);
+    void watchContent(WidgetFrame* frame);
+    void watch(QObject* object);
+    bool isEligible(const WidgetFrame* frame) const;
+    void checkNext();
+    void rest(WidgetFrame* frame);
+    void onSnapshotPainted();
+    void contentChanged(QObject* object);
+    void scheduleCheck();
+
+    WidgetCanvas& canvas_;
+    QElapsedTimer clock_;
+    QTimer checkTimer_;
+    OptIn optIn_;
+    QHash<const WidgetFrame*, Card> cards_;
+    bool enabled_ = true;
+    bool rendering_ = false;
+    Stats stats_;
+};
+
+}  // namespace dashboard
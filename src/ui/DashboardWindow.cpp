@@ -16,101 +16,585 @@
 #include "DashboardWindow.h"
 
 #include "AddWidgetDialog.h"
+#include "CanvasOverview.h"
+#include "ContentCache.h"
+#include "PerfOverlay.h"
+#include "PreviewCache.h"
+#include "RemoteWidgetView.h"
+#include "RestorePipeline.h"
+#include "StartupSnapshot.h"
 #include "SettingsDialog.h"
+#include "Theme.h"
 #include "TitleBar.h"
 #include "WidgetCanvas.h"
 #include "WidgetFrame.h"
 #include "core/ConfigStore.h"
+#include "core/IdleScheduler.h"
 #include "core/LayoutEngine.h"
+#include "core/Metrics.h"
+#include "core/PerfMonitor.h"
+#include "core/PowerProfile.h"
 #include "core/WidgetDataStore.h"
 #include "core/WidgetManager.h"
 
+#include <QApplication>
 #include <QCloseEvent>
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDeadlineTimer>
+#include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <dashboard/IWidget.h>
 #include <QGuiApplication>
+#include <QInputDialog>
 #include <QMenu>
 #include <QMenuBar>
+#include <QMessageBox>
 #include <QScreen>
+#include <QScrollArea>
+#include <QScrollBar>
+#include <QStackedWidget>
+#include <QWheelEvent>
+#include <QStandardPaths>
 #include <QVBoxLayout>
+#include <functional>
+#include <utility>
 
 namespace dashboard {
 
+static constexpr int kIsolatedSaveTimeoutMs = 1000;
+static constexpr int kThumbnailWidth = 160;
+static constexpr int kMaxWorkspaceShortcuts = 9;
+static constexpr int kMaxCanvasSizeFactor = 8;
+static constexpr double kZoomStep = 1.25;
+// Refresh the startup snapshot once the dashboard has been left alone this long
+static constexpr int kSnapshotIdleMs = 30000;
+
+static RemoteWidgetView* remoteView(WidgetFrame* frame) {
+    return qobject_cast<RemoteWidgetView*>(frame->contentWidget());
+}
+
+// Housekeeping for the IdleScheduler; runs at once when there is none
+static int runWhenIdle(QObject* context, const QString& name, IdleScheduler::Priority priority,
+                       std::function<void()> work) {
+    if (auto* idle = IdleScheduler::instance()) {
+        return idle->post(name, [work = std::move(work)]() {
+            work();
+            return false;
+        }, priority, context);
+    }
+    work();
+    return 0;
+}
+
 DashboardWindow::DashboardWindow(WidgetManager& widgetManager, ConfigStore& config,
-                                 LayoutEngine& layoutEngine, QWidget* parent)
+                                 LayoutEngine& layoutEngine, const QString& workspace,
+                                 QWidget* parent)
     : QMainWindow(parent),
       widgetManager_(widgetManager),
       config_(config),
       layoutEngine_(layoutEngine) {
+    workspace_ = workspace.isEmpty() ? config_.get(config::currentWorkspace) : workspace;
+    if (!LayoutEngine::workspaceNames().contains(workspace_)) {
+        workspace_ = LayoutEngine::defaultWorkspace();
+    }
+
     setupUi();
     restoreWindowGeometry();
 
     canvas_->applyBackground(config_);
 
+    // Isolation mode: each widget runs in its own helper process
+    isolateWidgets_ = config_.get(config::isolatedWidgets);
+    widgetManager_.setIsolated(isolateWidgets_);
+    if (isolateWidgets_) {
+        canvas_->setContentFactory([this](IWidget* widget, QWidget* parent) -> QWidget* {
+            return new RemoteWidgetView(widgetManager_.pluginFilePath(widget), parent);
+        });
+    }
+    widgetManager_.setLoadBudgetMs(config_.get(config::pluginLoadBudgetMs));
+    // A remote card already paints a pixmap, so there is nothing to cache
+    canvas_->contentCache().setEnabled(!isolateWidgets_);
+    canvas_->contentCache().setOptIn([this](const QString& pluginName) {
+        const PluginInfo* info = widgetManager_.pluginInfo(pluginName);
+        return info && info->cacheable;
+    });
+
     connect(canvas_, &WidgetCanvas::addWidgetRequested, this, &DashboardWindow::openAddWidget);
+    connect(canvas_, &WidgetCanvas::pluginAttached, &widgetManager_, &WidgetManager::retain);
+    connect(canvas_, &WidgetCanvas::pluginDetached, &widgetManager_, &WidgetManager::release);
     connect(canvas_, &WidgetCanvas::widgetAdded, this, &DashboardWindow::onWidgetAdded);
     connect(canvas_, &WidgetCanvas::widgetRemoved, this, &DashboardWindow::onWidgetRemoved);
+    connect(canvas_, &WidgetCanvas::layoutCommitted, this, &DashboardWindow::onLayoutCommitted);
+    // An isolated helper saves and then exits after its view is gone
+    connect(canvas_, &WidgetCanvas::contentUnloading, this, &DashboardWindow::saveWidgetState);
+    connect(canvas_, &WidgetCanvas::contentLoading, this, &DashboardWindow::restoreWidgetState);
+    connect(canvas_, &WidgetCanvas::contentLoaded, this, &DashboardWindow::startIsolatedHost);
+
+    restorePipeline_ = new RestorePipeline(*canvas_, widgetManager_, this);
+    // Remote cards load their own state in the helper process
+    restorePipeline_->setPrefetchState(!isolateWidgets_);
+    // Outlives the dialog so previews keep rendering after it closes
+    previewCache_ = new PreviewCache(this);
+    connect(restorePipeline_, &RestorePipeline::firstMeaningfulPaint, this, [](qint64 ms) {
+        metrics::restoreFirstPaintMs.store(ms, std::memory_order_relaxed);
+    });
+    connect(restorePipeline_, &RestorePipeline::finished, this, [this](qint64 ms) {
+        metrics::restoreCompleteMs.store(ms, std::memory_order_relaxed);
+        if (startupSnapshot_) {
+            startupSnapshot_->revealAll();
+        }
+        snapshotTimer_.start();
+    });
+    connect(canvas_, &WidgetCanvas::contentLoaded, this, [this](WidgetFrame* frame) {
+        if (startupSnapshot_) {
+            startupSnapshot_->reveal(frame);
+        }
+    });
+
+    snapshotTimer_.setSingleShot(true);
+    snapshotTimer_.setInterval(kSnapshotIdleMs);
+    connect(&snapshotTimer_, &QTimer::timeout, this, [this]() {
+        runWhenIdle(this, "startup-snapshot", IdleScheduler::Priority::Low,
+                    [this]() { saveStartupSnapshot(); });
+    });
+    applyCanvasSettings();
+    connect(&config_, &ConfigStore::changed, this, &DashboardWindow::onConfigChanged);
+
+    if (auto* power = PowerProfile::instance()) {
+        canvas_->setLowPower(power->isLowPower());
+        connect(power, &PowerProfile::changed, canvas_, &WidgetCanvas::setLowPower);
+    }
+
+    if (auto* monitor = PerfMonitor::instance()) {
+        connect(monitor, &PerfMonitor::slowCall, this, &DashboardWindow::onSlowPluginCall,
+                Qt::QueuedConnection);
+    }
 }
 
 WidgetCanvas* DashboardWindow::canvas() const {
     return canvas_;
 }
 
-void DashboardWindow::restoreLayout() {
-    QString layoutPath = LayoutEngine::layoutFilePath();
-    bool fileExists = QFile::exists(layoutPath);
+void DashboardWindow::showPlaceholders() {
+    firstRun_ = !QFile::exists(LayoutEngine::layoutFilePath(workspace_));
+    layoutEngine_.loadWorkspace(workspace_);
+
+    // Saved cards appear immediately; restoreLayout() fills them in once plugins are loaded
+    for (const auto& layout : layoutEngine_.allLayouts()) {
+        addPlaceholder(layout);
+    }
+
+    // Clamp all restored widget positions to the current canvas size.
+    // Necessary when the saved layout was made on a different screen configuration.
+    canvas_->clampFramePositions();
+
+    // Paint last session's pixels over the placeholders while plugins load
+    if (!firstRun_ && !readOnly_) {
+        startupSnapshot_ = StartupSnapshot::restore(*canvas_, snapshotTag(),
+                                                    scrollArea_->viewport());
+    }
+    awaitingFirstPaint_ = true;
+    scrollArea_->viewport()->update();
+}
+
+void DashboardWindow::saveStartupSnapshot() {
+    // Only a fully restored, live canvas is worth showing next time
+    if (readOnly_ || !layoutReady_ || restorePipeline_->isRunning() || startupSnapshot_
+        || viewStack_->currentWidget() != scrollArea_ || !isVisible()) {
+        return;
+    }
+    bool overlayVisible = perfOverlay_->isVisible();
+    perfOverlay_->hide();
+    StartupSnapshot::save(*canvas_, snapshotTag());
+    perfOverlay_->setVisible(overlayVisible);
+}
 
-    if (fileExists) {
-        layoutEngine_.loadFromFile(layoutPath);
+QByteArray DashboardWindow::snapshotTag() const {
+    QCryptographicHash hash(QCryptographicHash::Sha1);
+    QFile layout(LayoutEngine::layoutFilePath(workspace_));
+    if (layout.open(QIODevice::ReadOnly)) {
+        hash.addData(layout.readAll());
+    }
+    for (const auto& key : {config::theme, config::backgroundMode, config::backgroundColor,
+                            config::backgroundImagePath}) {
+        hash.addData(config_.get(key).toUtf8());
+        hash.addData(QByteArrayView("\n"));
     }
+    hash.addData(QByteArray::number(config_.get(config::backgroundOpacity)));
+    hash.addData(QByteArray::number(config_.get(config::canvasSizeFactor)));
+    hash.addData(workspace_.toUtf8());
+    return hash.result();
+}
 
-    if (!fileExists) {
+void DashboardWindow::restoreLayout() {
+    showQuarantineNotice();
+    if (firstRun_) {
         // First run only (no layout file at all): place all loaded plugins
         layoutReady_ = true;
+        WidgetCanvas::Batch batch(*canvas_);
         int offset = 20;
-        for (auto* widget : widgetManager_.widgets()) {
-            canvas_->addWidget(widget, QPoint(offset, offset));
-            offset += 30;
+        for (const auto& info : widgetManager_.plugins()) {
+            if (IWidget* widget = widgetManager_.findByName(info.name)) {
+                canvas_->addWidget(widget, QPoint(offset, offset));
+                offset += 30;
+            }
         }
         return;
     }
 
     // Restore saved layout (may be empty if user deleted all widgets)
-    for (const auto& layout : layoutEngine_.allLayouts()) {
-        IWidget* plugin = widgetManager_.findByName(layout.pluginName);
-        if (!plugin) {
-            continue;
+    restorePipeline_->start(placeholders());
+    layoutReady_ = true;
+}
+
+void DashboardWindow::showQuarantineNotice() {
+    const QStringList files = widgetManager_.quarantinedFiles();
+    if (files.isEmpty() || readOnly_) {
+        return;
+    }
+    QStringList names;
+    for (const QString& file : files) {
+        names << QFileInfo(file).fileName();
+    }
+    auto* box = new QMessageBox(
+        QMessageBox::Warning, "Widget Plugins",
+        QString("The dashboard stopped while loading %1 during the last start, so it was "
+                "not loaded this time. Its cards stay empty until you retry it.")
+            .arg(names.join(", ")),
+        QMessageBox::NoButton, this);
+    auto* retryButton = box->addButton("Retry", QMessageBox::AcceptRole);
+    box->addButton("Keep Disabled", QMessageBox::RejectRole);
+    box->setAttribute(Qt::WA_DeleteOnClose);
+    connect(box, &QMessageBox::buttonClicked, this, [this, retryButton](QAbstractButton* button) {
+        if (button == retryButton) {
+            retryQuarantinedPlugins();
         }
-        // Deserialize before createWidget so widgets can use state during construction
-        QJsonObject data = WidgetDataStore::load(layout.instanceId);
-        if (!data.isEmpty()) {
-            plugin->deserialize(data);
+    });
+    // Not modal: the rest of the dashboard is usable meanwhile
+    box->setModal(false);
+    box->show();
+}
+
+void DashboardWindow::retryQuarantinedPlugins() {
+    widgetManager_.retryQuarantined();
+    if (layoutReady_) {
+        restorePipeline_->start(placeholders());
+    }
+}
+
+WidgetFrame* DashboardWindow::addPlaceholder(const WidgetLayout& layout) {
+    // The layout engine already has this entry; keep onWidgetAdded from adding another
+    restoringFrame_ = true;
+    auto* frame = canvas_->addPlaceholder(layout.pluginName, QRect(layout.position, layout.size));
+    restoringFrame_ = false;
+    frame->setWidgetId(layout.instanceId);
+    return frame;
+}
+
+QList<WidgetFrame*> DashboardWindow::placeholders() const {
+    QList<WidgetFrame*> result;
+    for (auto* frame : canvas_->frames()) {
+        if (frame->isPlaceholder()) {
+            result.append(frame);
         }
-        auto* frame = canvas_->addWidget(plugin, layout.position);
-        frame->setWidgetId(layout.instanceId);
-        frame->resize(layout.size);
     }
-    layoutReady_ = true;
+    return result;
+}
 
-    // Clamp all restored widget positions to the current canvas size.
-    // Necessary when the saved layout was made on a different screen configuration.
-    canvas_->clampFramePositions();
+QString DashboardWindow::currentWorkspace() const {
+    return workspace_;
+}
+
+void DashboardWindow::switchWorkspace(const QString& name) {
+    if (name == workspace_ || !layoutReady_) {
+        return;
+    }
+    saveThumbnail();
+    saveLayout();
+    restorePipeline_->cancel();
+
+    workspace_ = name;
+    config_.set(config::currentWorkspace, workspace_);
+    layoutEngine_.loadWorkspace(workspace_);
+    updateWindowTitle();
+
+    // Keep instances the two workspaces share and unload the rest.
+    // Their state was written by saveLayout above. The cards change in one batch.
+    {
+        WidgetCanvas::Batch batch(*canvas_);
+        QSet<QString> kept;
+        for (auto* frame : QList<WidgetFrame*>(canvas_->frames())) {
+            if (layoutEngine_.contains(frame->widgetId())) {
+                WidgetLayout layout = layoutEngine_.widgetLayout(frame->widgetId());
+                canvas_->setFrameGeometry(frame, QRect(layout.position, layout.size));
+                kept.insert(frame->widgetId());
+            } else {
+                canvas_->unloadWidget(frame);
+            }
+        }
+
+        for (const auto& layout : layoutEngine_.allLayouts()) {
+            if (!kept.contains(layout.instanceId)) {
+                addPlaceholder(layout);
+            }
+        }
+        canvas_->clampFramePositions();
+    }
+    // Includes shared cards a cancelled restore had not reached yet
+    restorePipeline_->start(placeholders());
+}
+
+void DashboardWindow::populateWorkspaceMenu() {
+    workspaceMenu_->clear();
+    const QStringList names = LayoutEngine::workspaceNames();
+    for (int i = 0; i < names.size(); ++i) {
+        const QString name = names.at(i);
+        // The shortcuts themselves are window actions; only show the hint here
+        QString text = name;
+        if (i < kMaxWorkspaceShortcuts) {
+            text += QString("\tCtrl+%1").arg(i + 1);
+        }
+        auto* action = workspaceMenu_->addAction(QIcon(thumbnailPath(name)), text, this,
+                                                 [this, name]() { switchWorkspace(name); });
+        action->setCheckable(true);
+        action->setChecked(name == workspace_);
+    }
+    workspaceMenu_->addSeparator();
+    workspaceMenu_->addAction("New Workspace...", this, [this]() { newWorkspace(false); });
+    workspaceMenu_->addAction("Duplicate Workspace...", this, [this]() { newWorkspace(true); });
+    auto* deleteAction = workspaceMenu_->addAction("Delete Workspace", this,
+                                                   &DashboardWindow::deleteWorkspace);
+    deleteAction->setEnabled(workspace_ != LayoutEngine::defaultWorkspace());
+}
+
+void DashboardWindow::newWorkspace(bool duplicate) {
+    bool ok = false;
+    QString name = QInputDialog::getText(this, duplicate ? "Duplicate Workspace" : "New Workspace",
+                                         "Name:", QLineEdit::Normal, QString(), &ok).trimmed();
+    if (!ok || name.isEmpty()) {
+        return;
+    }
+    if (!LayoutEngine::isValidWorkspaceName(name)
+        || LayoutEngine::workspaceNames().contains(name)) {
+        QMessageBox::warning(this, "Workspaces",
+                             QString("\"%1\" is not an available workspace name.").arg(name));
+        return;
+    }
+
+    // A duplicate shares its instances with the original; a new workspace starts empty
+    saveLayout();
+    LayoutEngine target;
+    if (duplicate) {
+        target.loadFromFile(LayoutEngine::layoutFilePath(workspace_));
+    }
+    target.saveToFile(LayoutEngine::layoutFilePath(name));
+    switchWorkspace(name);
+}
+
+void DashboardWindow::deleteWorkspace() {
+    const QString doomed = workspace_;
+    if (doomed == LayoutEngine::defaultWorkspace()) {
+        return;
+    }
+    auto answer = QMessageBox::question(this, "Workspaces",
+                                        QString("Delete workspace \"%1\"?").arg(doomed));
+    if (answer != QMessageBox::Yes) {
+        return;
+    }
+
+    const QList<WidgetLayout> layouts = LayoutEngine::layoutsIn(doomed);
+    switchWorkspace(LayoutEngine::defaultWorkspace());
+    QFile::remove(LayoutEngine::layoutFilePath(doomed));
+    QFile::remove(thumbnailPath(doomed));
+    layoutEngine_.reserveOtherWorkspaces(workspace_);
+
+    // Drop state that no remaining workspace refers to, once nothing else is going on
+    runWhenIdle(this, "drop-widget-data:" + doomed, IdleScheduler::Priority::Low,
+                [this, layouts]() {
+                    for (const auto& layout : layouts) {
+                        if (!layoutEngine_.contains(layout.instanceId)
+                            && !layoutEngine_.isUsedElsewhere(layout.instanceId)) {
+                            WidgetDataStore::remove(layout.instanceId);
+                        }
+                    }
+                });
+}
+
+void DashboardWindow::saveThumbnail() {
+    if (readOnly_) {
+        return;
+    }
+    bool overlayVisible = perfOverlay_->isVisible();
+    perfOverlay_->hide();
+    const QPixmap pixmap = canvas_->grab(canvas_->visibleRect());
+    perfOverlay_->setVisible(overlayVisible);
+
+    // Only the grab has to happen now; scaling and PNG encoding can wait
+    runWhenIdle(this, "thumbnail:" + workspace_, IdleScheduler::Priority::Low,
+                [pixmap, workspace = workspace_, path = thumbnailPath(workspace_)]() {
+                    // deleteWorkspace switches away first, which queues one for the doomed workspace
+                    if (!LayoutEngine::workspaceNames().contains(workspace)) {
+                        return;
+                    }
+                    QDir().mkpath(QFileInfo(path).absolutePath());
+                    pixmap.scaledToWidth(kThumbnailWidth, Qt::SmoothTransformation)
+                        .save(path, "PNG");
+                });
+}
+
+void DashboardWindow::updateWindowTitle() {
+    QString title = "Dashboard";
+    if (workspace_ != LayoutEngine::defaultWorkspace()) {
+        title += " \u2014 " + workspace_;
+    }
+    setWindowTitle(title);
+    titleBar_->setTitle(title);
+}
+
+QString DashboardWindow::thumbnailPath(const QString& workspace) {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/workspaces/"
+           + workspace + ".png";
 }
 
 void DashboardWindow::closeEvent(QCloseEvent* event) {
     saveWindowGeometry();
+    saveThumbnail();
     saveLayout();
+    saveStartupSnapshot();
+    if (auto* idle = IdleScheduler::instance()) {
+        idle->flush();
+    }
+    // Stay resident so the next launch only has to show the window
+    if (config_.get(config::keepRunning) && !quitting_) {
+        hide();
+        event->ignore();
+        return;
+    }
+    // Helpers are killed on exit, so wait for the saves requested above. Every
+    // helper already has its request; one deadline covers them all.
+    const QDeadlineTimer deadline(kIsolatedSaveTimeoutMs);
+    for (auto* frame : canvas_->frames()) {
+        if (auto* remote = remoteView(frame)) {
+            remote->waitForSaved(int(deadline.remainingTime()));
+        }
+    }
     QMainWindow::closeEvent(event);
+    qApp->quit();
 }
 
-void DashboardWindow::resizeEvent(QResizeEvent* event) {
-    QMainWindow::resizeEvent(event);
+void DashboardWindow::activate() {
+    if (isMinimized()) {
+        showNormal();
+    } else {
+        show();
+    }
+    raise();
+    activateWindow();
+}
 
-    // After canvas clamps frame positions, sync them to the layout engine
-    for (auto* frame : canvas_->frames()) {
-        layoutEngine_.updatePosition(frame->widgetId(), frame->pos());
+void DashboardWindow::setReadOnly(bool readOnly) {
+    readOnly_ = readOnly;
+}
+
+void DashboardWindow::resizeViewport(const QSize& size) {
+    resize(this->size() + size - scrollArea_->viewport()->size());
+}
+
+bool DashboardWindow::addWidgetByName(const QString& pluginName) {
+    IWidget* widget = widgetManager_.findByName(pluginName);
+    if (!widget) {
+        return false;
     }
-    saveLayout();
+    canvas_->addWidget(widget, canvas_->centerPosition(widget->metadata().defaultSize));
+    return true;
+}
+
+void DashboardWindow::quit() {
+    quitting_ = true;
+    close();
+}
+
+bool DashboardWindow::eventFilter(QObject* watched, QEvent* event) {
+    if (watched == scrollArea_->viewport() && event->type() == QEvent::Resize) {
+        applyCanvasSize();
+    }
+    // The viewport paints first in a frame; report once the placeholders are done too
+    if (watched == scrollArea_->viewport() && event->type() == QEvent::Paint
+        && awaitingFirstPaint_) {
+        awaitingFirstPaint_ = false;
+        QTimer::singleShot(0, this, &DashboardWindow::placeholdersPainted);
+    }
+    // Ctrl+wheel down on the canvas switches to the overview around the cursor
+    if (watched == scrollArea_->viewport() && event->type() == QEvent::Wheel) {
+        auto* wheel = static_cast<QWheelEvent*>(event);
+        if ((wheel->modifiers() & Qt::ControlModifier) && wheel->angleDelta().y() < 0) {
+            showOverview(canvas_->mapFrom(scrollArea_->viewport(), wheel->position()),
+                         1.0 / kZoomStep);
+            return true;
+        }
+    }
+    return QMainWindow::eventFilter(watched, event);
+}
+
+void DashboardWindow::zoomIn() {
+    if (viewStack_->currentWidget() != overview_) {
+        return;
+    }
+    const QPointF center = QRectF(overview_->rect()).center();
+    double zoom = overview_->zoom() * kZoomStep;
+    if (zoom > 0.99) {
+        showCanvasAt(overview_->mapToCanvas(center));
+    } else {
+        overview_->setZoom(zoom, center);
+    }
+}
+
+void DashboardWindow::zoomOut() {
+    if (viewStack_->currentWidget() == overview_) {
+        const QPointF center = QRectF(overview_->rect()).center();
+        overview_->setZoom(overview_->zoom() / kZoomStep, center);
+    } else {
+        showOverview(QRectF(canvas_->visibleRect()).center(), 1.0 / kZoomStep);
+    }
+}
+
+void DashboardWindow::showOverview(const QPointF& canvasPoint, double zoom) {
+    // Hiding the live canvas stops all card painting while zoomed out
+    viewStack_->setCurrentWidget(overview_);
+    overview_->centerOn(canvasPoint, zoom);
+}
+
+void DashboardWindow::showCanvasAt(const QPointF& canvasPoint) {
+    viewStack_->setCurrentWidget(scrollArea_);
+    const QSize view = scrollArea_->viewport()->size();
+    scrollArea_->horizontalScrollBar()->setValue(int(canvasPoint.x()) - view.width() / 2);
+    scrollArea_->verticalScrollBar()->setValue(int(canvasPoint.y()) - view.height() / 2);
+    updateVisibleRect();
+}
+
+void DashboardWindow::applyCanvasSettings() {
+    canvasSizeFactor_ =
+        qBound(1, config_.get(config::canvasSizeFactor), kMaxCanvasSizeFactor);
+    QString policy = config_.get(config::canvasOffscreen);
+    canvas_->setOffscreenPolicy(policy == "unload" ? WidgetCanvas::OffscreenPolicy::Unload
+                                : policy == "live" ? WidgetCanvas::OffscreenPolicy::Live
+                                                   : WidgetCanvas::OffscreenPolicy::Snapshot);
+    applyCanvasSize();
+}
+
+void DashboardWindow::applyCanvasSize() {
+    QSize size = scrollArea_->viewport()->size() * canvasSizeFactor_;
+    if (canvas_->size() != size) {
+        // Cards the resize pushes back inside arrive through layoutCommitted
+        canvas_->resize(size);
+    }
+    updateVisibleRect();
+}
+
+void DashboardWindow::updateVisibleRect() {
+    canvas_->setVisibleRect(QRect(-canvas_->pos(), scrollArea_->viewport()->size()));
 }
 
 void DashboardWindow::setupUi() {
@@ -122,49 +606,141 @@ void DashboardWindow::setupUi() {
     connect(app, &QGuiApplication::screenRemoved,  this, [this](QScreen*) { onScreensChanged(); });
 
     titleBar_ = new TitleBar(this);
-    titleBar_->setTitle("Dashboard");
+    updateWindowTitle();
     applyTitleBarHeight();
 
     auto* menu = new QMenu(this);
     auto* addWidgetAction = menu->addAction("Add Widget...", this, &DashboardWindow::openAddWidget);
+    workspaceMenu_ = menu->addMenu("Workspaces");
+    connect(workspaceMenu_, &QMenu::aboutToShow, this, &DashboardWindow::populateWorkspaceMenu);
     auto* settingsAction  = menu->addAction("Settings...",   this, &DashboardWindow::openSettings);
     menu->addSeparator();
-    auto* quitAction = menu->addAction("Quit", this, &QWidget::close);
+    auto* zoomInAction  = menu->addAction("Zoom In", this, &DashboardWindow::zoomIn);
+    zoomInAction->setShortcut(QKeySequence::ZoomIn);
+    auto* zoomOutAction = menu->addAction("Zoom Out", this, &DashboardWindow::zoomOut);
+    zoomOutAction->setShortcut(QKeySequence::ZoomOut);
+    auto* actualSizeAction = menu->addAction("Actual Size", this, [this]() {
+        if (viewStack_->currentWidget() == overview_) {
+            showCanvasAt(overview_->mapToCanvas(QRectF(overview_->rect()).center()));
+        }
+    });
+    actualSizeAction->setShortcut(QKeySequence(Qt::CTRL | Qt::Key_0));
+    menu->addSeparator();
+    auto* selectAllAction = menu->addAction("Select All Widgets", this, [this]() {
+        canvas_->selectAll();
+    });
+    selectAllAction->setShortcut(QKeySequence::SelectAll);
+    auto* deleteSelectedAction = menu->addAction("Delete Selected Widgets", this,
+                                                 &DashboardWindow::deleteSelectedWidgets);
+    deleteSelectedAction->setShortcut(QKeySequence::Delete);
+    deleteSelectedAction->setEnabled(false);
+    auto* clearSelectionAction = new QAction(this);
+    clearSelectionAction->setShortcut(Qt::Key_Escape);
+    clearSelectionAction->setEnabled(false);
+    connect(clearSelectionAction, &QAction::triggered, this, [this]() {
+        canvas_->clearSelection();
+    });
+    menu->addSeparator();
+    auto* retryPluginsAction = menu->addAction("Retry Quarantined Plugins", this,
+                                               &DashboardWindow::retryQuarantinedPlugins);
+    connect(menu, &QMenu::aboutToShow, this, [this, retryPluginsAction]() {
+        retryPluginsAction->setVisible(!widgetManager_.quarantinedFiles().isEmpty());
+    });
+    auto* overlayAction   = menu->addAction("Performance Overlay");
+    overlayAction->setCheckable(true);
+    overlayAction->setShortcut(Qt::Key_F12);
+    menu->addSeparator();
+    auto* quitAction = menu->addAction("Quit", this, &DashboardWindow::quit);
     quitAction->setShortcut(QKeySequence::Quit);
 
     // Register actions on the window so keyboard shortcuts work without a menu bar
     addAction(addWidgetAction);
     addAction(settingsAction);
+    addAction(zoomInAction);
+    addAction(zoomOutAction);
+    addAction(actualSizeAction);
+    addAction(selectAllAction);
+    addAction(deleteSelectedAction);
+    addAction(clearSelectionAction);
+    addAction(overlayAction);
     addAction(quitAction);
 
+    // Ctrl+1..9 switch workspaces even while the menu has never been opened
+    for (int i = 0; i < kMaxWorkspaceShortcuts; ++i) {
+        auto* action = new QAction(this);
+        action->setShortcut(QKeySequence(Qt::CTRL | (Qt::Key_1 + i)));
+        connect(action, &QAction::triggered, this, [this, i]() {
+            const QStringList names = LayoutEngine::workspaceNames();
+            if (i < names.size()) {
+                switchWorkspace(names.at(i));
+            }
+        });
+        addAction(action);
+    }
+
     menuBar()->hide();
     titleBar_->setMenu(menu);
 
-    canvas_ = new WidgetCanvas(this);
+    // The canvas may be several times the window's size; it scrolls inside the viewport
+    scrollArea_ = new QScrollArea(this);
+    scrollArea_->setFrameShape(QFrame::NoFrame);
+    scrollArea_->setWidgetResizable(false);
+    canvas_ = new WidgetCanvas;
+    scrollArea_->setWidget(canvas_);
+    scrollArea_->viewport()->installEventFilter(this);
+    connect(scrollArea_->horizontalScrollBar(), &QScrollBar::valueChanged, this,
+            &DashboardWindow::updateVisibleRect);
+    connect(scrollArea_->verticalScrollBar(), &QScrollBar::valueChanged, this,
+            &DashboardWindow::updateVisibleRect);
+    connect(canvas_, &WidgetCanvas::selectionChanged, this,
+            [deleteSelectedAction, clearSelectionAction](int count) {
+                deleteSelectedAction->setEnabled(count > 0);
+                clearSelectionAction->setEnabled(count > 0);
+            });
+
+    // Parented to the viewport so the overlay stays put while the canvas scrolls
+    perfOverlay_ = new PerfOverlay(*canvas_, widgetManager_,
+                                   config_.get(config::hudHistoryMinutes),
+                                   scrollArea_->viewport());
+    perfOverlay_->move(12, 12);
+    perfOverlay_->hide();
+    connect(overlayAction, &QAction::toggled, this, [this](bool on) {
+        perfOverlay_->setVisible(on);
+        perfOverlay_->raise();
+    });
 
     auto* container = new QWidget(this);
     auto* vbox = new QVBoxLayout(container);
     vbox->setContentsMargins(0, 0, 0, 0);
     vbox->setSpacing(0);
     vbox->addWidget(titleBar_);
-    vbox->addWidget(canvas_, 1);
+    overview_ = new CanvasOverview(*canvas_, this);
+    connect(overview_, &CanvasOverview::zoomInRequested, this, &DashboardWindow::showCanvasAt);
+
+    viewStack_ = new QStackedWidget(this);
+    viewStack_->addWidget(scrollArea_);
+    viewStack_->addWidget(overview_);
+    vbox->addWidget(viewStack_, 1);
     setCentralWidget(container);
 }
 
 
 
 void DashboardWindow::applyWindowSize() {
-    int percent = config_.value("window/sizePercent", 60).toInt();
+    int percent = config_.get(config::windowSizePercent);
     const QRect screen = QGuiApplication::primaryScreen()->availableGeometry();
     resize(screen.width() * percent / 100, screen.height() * percent / 100);
 }
 
 void DashboardWindow::saveWindowGeometry() {
-    config_.setValue("window/geometry", saveGeometry());
+    if (readOnly_) {
+        return;
+    }
+    config_.set(config::windowGeometry, saveGeometry());
 }
 
 void DashboardWindow::restoreWindowGeometry() {
-    QByteArray geo = config_.value("window/geometry").toByteArray();
+    QByteArray geo = config_.get(config::windowGeometry);
     if (!geo.isEmpty() && restoreGeometry(geo)) {
         // Verify the restored window intersects at least one available screen.
         // If not (e.g. the monitor it was on is gone), fall back to primary screen.
@@ -207,37 +783,61 @@ void DashboardWindow::onScreensChanged() {
         move(primary.topLeft() + QPoint(40, 40));
     }
 
-    // Re-clamp widget positions in case the canvas size changed.
-    canvas_->clampFramePositions();
+    // Re-clamp widget positions in case the canvas size changed. Screen changes
+    // come in bursts, and the clamp is coalesced into one.
+    runWhenIdle(this, "clamp-frames", IdleScheduler::Priority::High,
+                [this]() { canvas_->clampFramePositions(); });
 }
 
 void DashboardWindow::applyTitleBarHeight() {
-    int height = config_.value("window/titleBarHeight", 36).toInt();
+    int height = config_.get(config::titleBarHeight);
     titleBar_->setFixedHeight(height);
 }
 
-void DashboardWindow::openSettings() {
-    auto* dialog = new SettingsDialog(config_, this);
-    connect(dialog, &SettingsDialog::backgroundChanged, this, [this]() {
+void DashboardWindow::onConfigChanged(const QStringList& keys) {
+    auto touched = [&keys](std::initializer_list<const char*> names) {
+        for (const char* name : names) {
+            if (keys.contains(QLatin1String(name))) {
+                return true;
+            }
+        }
+        return false;
+    };
+    if (touched({config::backgroundMode.name, config::backgroundColor.name,
+                 config::backgroundImagePath.name, config::backgroundOpacity.name})) {
         canvas_->applyBackground(config_);
-    });
-    connect(dialog, &SettingsDialog::windowSizeChanged, this, [this]() {
+    }
+    if (touched({config::windowSizePercent.name})) {
         applyWindowSize();
-    });
-    connect(dialog, &SettingsDialog::titleBarHeightChanged, this, [this]() {
+    }
+    if (touched({config::titleBarHeight.name})) {
         applyTitleBarHeight();
-    });
+    }
+    if (touched({config::theme.name})) {
+        Theme::apply(*qApp, Theme::byName(config_.get(config::theme)));
+    }
+    if (touched({config::canvasSizeFactor.name, config::canvasOffscreen.name})) {
+        applyCanvasSettings();
+    }
+}
+
+void DashboardWindow::openSettings() {
+    auto* dialog = new SettingsDialog(config_, this);
     dialog->exec();
     dialog->deleteLater();
 }
 
 void DashboardWindow::openAddWidget() {
-    auto* dialog = new AddWidgetDialog(widgetManager_, this);
+    auto* dialog = new AddWidgetDialog(widgetManager_, *previewCache_, this);
     if (dialog->exec() == QDialog::Accepted) {
+        WidgetCanvas::Batch batch(*canvas_);
         int offset = 0;
-        for (auto* widget : dialog->selectedWidgets()) {
-            auto meta = widget->metadata();
-            QPoint center = canvas_->centerPosition(meta.defaultSize);
+        for (const auto& name : dialog->selectedPlugins()) {
+            IWidget* widget = widgetManager_.findByName(name);
+            if (!widget) {
+                continue;
+            }
+            QPoint center = canvas_->centerPosition(widget->metadata().defaultSize);
             canvas_->addWidget(widget, QPoint(center.x() + offset, center.y() + offset));
             offset += 30;
         }
@@ -246,56 +846,113 @@ void DashboardWindow::openAddWidget() {
 }
 
 void DashboardWindow::saveLayout() {
-    if (!layoutReady_) {
+    if (auto* idle = IdleScheduler::instance()) {
+        idle->cancel(std::exchange(saveLayoutTask_, 0));
+    }
+    if (!layoutReady_ || readOnly_) {
         return;
     }
     // Persist each widget's own data to its dedicated file
     for (auto* frame : canvas_->frames()) {
-        if (IWidget* w = frame->iwidget()) {
-            QJsonObject data = w->serialize();
-            if (!data.isEmpty()) {
-                WidgetDataStore::save(frame->widgetId(), data);
-            }
+        saveWidgetState(frame);
+    }
+    layoutEngine_.saveToFile(LayoutEngine::layoutFilePath(workspace_));
+    snapshotTimer_.start();
+}
+
+void DashboardWindow::saveWidgetState(WidgetFrame* frame) {
+    // Unloaded cards have no content; their state was saved when it was destroyed
+    if (!frame->contentWidget() || readOnly_) {
+        return;
+    }
+    if (auto* remote = remoteView(frame)) {
+        remote->requestSave();
+    } else if (IWidget* w = frame->iwidget()) {
+        QJsonObject data;
+        {
+            PluginScope scope(frame->pluginName(), frame->widgetId(), PluginCall::Serialize);
+            data = w->serialize();
+        }
+        if (!data.isEmpty()) {
+            WidgetDataStore::save(frame->widgetId(), data);
         }
     }
-    layoutEngine_.saveToFile(LayoutEngine::layoutFilePath());
 }
 
-void DashboardWindow::onWidgetAdded(WidgetFrame* frame) {
-    // Connect move/resize signals to persist layout changes
-    connect(frame, &WidgetFrame::moved, this, [this, frame]() {
-        onWidgetMoved(frame);
-    });
-    connect(frame, &WidgetFrame::resized, this, [this, frame]() {
-        onWidgetResized(frame);
-    });
+void DashboardWindow::restoreWidgetState(WidgetFrame* frame) {
+    IWidget* plugin = frame->iwidget();
+    if (isolateWidgets_ || !plugin) {
+        return;
+    }
+    QJsonObject data = restorePipeline_->takeState(frame->widgetId());
+    if (!data.isEmpty()) {
+        PluginScope scope(frame->pluginName(), frame->widgetId(), PluginCall::Deserialize);
+        plugin->deserialize(data);
+    }
+}
 
-    if (!layoutReady_) {
+void DashboardWindow::onWidgetAdded(WidgetFrame* frame) {
+    if (!layoutReady_ || restoringFrame_) {
         // During restore, the layout engine already has the entries;
-        // the instance ID is set by restoreLayout after this returns.
+        // the instance ID is set by addPlaceholder after this returns.
         return;
     }
 
     QString instanceId =
         layoutEngine_.addWidget(frame->pluginName(), frame->pos(), frame->size());
     frame->setWidgetId(instanceId);
-    saveLayout();
+    startIsolatedHost(frame);
+    // Saved when the canvas commits the addition (onLayoutCommitted)
 }
 
-void DashboardWindow::onWidgetMoved(WidgetFrame* frame) {
-    layoutEngine_.updatePosition(frame->widgetId(), frame->pos());
-    saveLayout();
+void DashboardWindow::onSlowPluginCall(const QString& pluginName, const QString& instanceId,
+                                       PluginCall call, qint64 ms) {
+    QString message = QString("Slow %1: %2 ms").arg(pluginCallName(call)).arg(ms);
+    for (auto* frame : canvas_->frames()) {
+        // createWidget runs before the instance has an ID; flag every card of that plugin
+        bool match = instanceId.isEmpty() ? frame->pluginName() == pluginName
+                                          : frame->widgetId() == instanceId;
+        if (match) {
+            frame->addWarning(message);
+        }
+    }
 }
 
-void DashboardWindow::onWidgetResized(WidgetFrame* frame) {
-    layoutEngine_.updateSize(frame->widgetId(), frame->size());
-    saveLayout();
+void DashboardWindow::startIsolatedHost(WidgetFrame* frame) {
+    if (auto* remote = remoteView(frame)) {
+        remote->start(frame->widgetId());
+    }
 }
 
 void DashboardWindow::onWidgetRemoved(const QString& instanceId) {
+    // Saved once the canvas commits the removal (onLayoutCommitted)
     layoutEngine_.removeWidget(instanceId);
-    WidgetDataStore::remove(instanceId);
-    saveLayout();
+    // Another workspace may still show this instance
+    if (!layoutEngine_.isUsedElsewhere(instanceId)) {
+        WidgetDataStore::remove(instanceId);
+    }
+}
+
+void DashboardWindow::onLayoutCommitted(const QList<WidgetFrame*>& changed) {
+    for (auto* frame : changed) {
+        layoutEngine_.updateGeometry(frame->widgetId(), frame->geometry());
+    }
+    // Serializing every widget and writing the file wait for an idle moment
+    saveLayoutTask_ = runWhenIdle(this, "save-layout", IdleScheduler::Priority::Normal,
+                                  [this]() { saveLayout(); });
+}
+
+void DashboardWindow::deleteSelectedWidgets() {
+    const int count = int(canvas_->selection().size());
+    if (count == 0) {
+        return;
+    }
+    auto answer = QMessageBox::question(
+        this, "Delete Widgets", QString("Remove %1 selected widgets from the dashboard?").arg(count),
+        QMessageBox::Yes | QMessageBox::No);
+    if (answer == QMessageBox::Yes) {
+        canvas_->removeSelected();
+    }
 }
 
 }  // namespace dashboard
@@ -15,12 +15,25 @@
 
 #pragma once
 
+#include "core/LayoutEngine.h"
+#include "core/PerfMonitor.h"
+
 #include <QMainWindow>
+#include <QPointer>
+#include <QTimer>
+
+class QMenu;
+class QScrollArea;
+class QStackedWidget;
 
 namespace dashboard {
 
+class CanvasOverview;
 class ConfigStore;
-class LayoutEngine;
+class PerfOverlay;
+class PreviewCache;
+class RestorePipeline;
+class StartupSnapshot;
 class TitleBar;
 class WidgetCanvas;
 class WidgetFrame;
@@ -30,38 +43,108 @@ class DashboardWindow : public QMainWindow {
     Q_OBJECT
 
 public:
-    explicit DashboardWindow(WidgetManager& widgetManager, ConfigStore& config,
-                             LayoutEngine& layoutEngine, QWidget* parent = nullptr);
+    // workspace overrides the saved current workspace without replacing it
+    DashboardWindow(WidgetManager& widgetManager, ConfigStore& config, LayoutEngine& layoutEngine,
+                    const QString& workspace = {}, QWidget* parent = nullptr);
 
     WidgetCanvas* canvas() const;
+    // Shows the saved cards as placeholders; needs no plugins. Emits
+    // placeholdersPainted once the window has painted them.
+    void showPlaceholders();
+    // Creates the real widgets progressively once plugins are loaded.
     void restoreLayout();
 
+    QString currentWorkspace() const;
+    void switchWorkspace(const QString& name);
+
+    // Commands forwarded by later launches
+    void activate();
+    bool addWidgetByName(const QString& pluginName);
+    // Closes and exits even when configured to keep running in the background
+    void quit();
+
+    // Headless rendering: never write layouts, widget state, geometry or snapshots
+    void setReadOnly(bool readOnly);
+    // Resizes the window so the canvas viewport gets exactly this size
+    void resizeViewport(const QSize& size);
+
+signals:
+    void placeholdersPainted();
+
 protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
     void closeEvent(QCloseEvent* event) override;
-    void resizeEvent(QResizeEvent* event) override;
 
 private:
     void setupUi();
     void openSettings();
     void openAddWidget();
     void saveLayout();
+    void saveWidgetState(WidgetFrame* frame);
+    void restoreWidgetState(WidgetFrame* frame);
+
+    void applyCanvasSettings();
+    void applyCanvasSize();
+    void updateVisibleRect();
+
+    void zoomIn();
+    void zoomOut();
+    void showOverview(const QPointF& canvasPoint, double zoom);
+    void showCanvasAt(const QPointF& canvasPoint);
 
     void applyWindowSize();
     void applyTitleBarHeight();
     void saveWindowGeometry();
     void restoreWindowGeometry();
     void onScreensChanged();
+    void onConfigChanged(const QStringList& keys);
     void onWidgetAdded(WidgetFrame* frame);
     void onWidgetRemoved(const QString& instanceId);
-    void onWidgetMoved(WidgetFrame* frame);
-    void onWidgetResized(WidgetFrame* frame);
+    void onLayoutCommitted(const QList<WidgetFrame*>& changed);
+    void deleteSelectedWidgets();
+    void startIsolatedHost(WidgetFrame* frame);
+    void showQuarantineNotice();
+    void retryQuarantinedPlugins();
+    WidgetFrame* addPlaceholder(const WidgetLayout& layout);
+    QList<WidgetFrame*> placeholders() const;
+
+    void populateWorkspaceMenu();
+    void newWorkspace(bool duplicate);
+    void deleteWorkspace();
+    void saveThumbnail();
+    void updateWindowTitle();
+    void saveStartupSnapshot();
+    QByteArray snapshotTag() const;
+    static QString thumbnailPath(const QString& workspace);
+    void onSlowPluginCall(const QString& pluginName, const QString& instanceId, PluginCall call,
+                          qint64 ms);
 
     TitleBar* titleBar_;
+    QStackedWidget* viewStack_;
+    QScrollArea* scrollArea_;
     WidgetCanvas* canvas_;
+    CanvasOverview* overview_;
+    PerfOverlay* perfOverlay_;
+    QMenu* workspaceMenu_;
     WidgetManager& widgetManager_;
     ConfigStore& config_;
     LayoutEngine& layoutEngine_;
+    RestorePipeline* restorePipeline_;
+    PreviewCache* previewCache_;
+    QPointer<StartupSnapshot> startupSnapshot_;
+    QTimer snapshotTimer_;
+    bool firstRun_ = false;
+    bool awaitingFirstPaint_ = false;
+    bool quitting_ = false;
     bool layoutReady_ = false;
+    int saveLayoutTask_ = 0;  // pending IdleScheduler task
+    bool restoringFrame_ = false;
+    bool isolateWidgets_ = false;
+    bool readOnly_ = false;
+    int canvasSizeFactor_ = 1;
+
+    // Active workspace; widgets of other workspaces exist only as saved state
+    QString workspace_;
 };
 
 }  // namespace dashboard
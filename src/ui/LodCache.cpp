@@ -0,0 +1,76 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "LodCache.h"
+
+namespace dashboard {
+
+static constexpr int kMinLevelWidth = 16;
+
+void LodCache::setBase(const QPixmap& base, quint64 generation) {
+    levels_.clear();
+    levels_.push_back(base);
+    generation_ = generation;
+}
+
+void LodCache::clear() {
+    levels_.clear();
+}
+
+bool LodCache::isEmpty() const {
+    return levels_.empty() || levels_.front().isNull();
+}
+
+quint64 LodCache::generation() const {
+    return generation_;
+}
+
+const QPixmap& LodCache::level(int targetWidth) {
+    // Walk down the chain, building levels as long as the next one is still wide enough
+    size_t index = 0;
+    while (true) {
+        const QPixmap& current = levels_[index];
+        int nextWidth = current.width() / 2;
+        if (nextWidth < targetWidth || nextWidth < kMinLevelWidth) {
+            return current;
+        }
+        if (index + 1 == levels_.size()) {
+            QPixmap next = current.scaled(current.size() / 2, Qt::IgnoreAspectRatio,
+                                          Qt::SmoothTransformation);
+            next.setDevicePixelRatio(current.devicePixelRatio());
+            levels_.push_back(next);
+        }
+        ++index;
+    }
+}
+
+void LodCache::trim(int targetWidth) {
+    if (isEmpty()) {
+        return;
+    }
+    QPixmap kept = level(targetWidth);
+    levels_.clear();
+    levels_.push_back(kept);
+}
+
+qint64 LodCache::byteSize() const {
+    qint64 bytes = 0;
+    for (const auto& pixmap : levels_) {
+        bytes += qint64(pixmap.width()) * pixmap.height() * pixmap.depth() / 8;
+    }
+    return bytes;
+}
+
+}  // namespace dashboard
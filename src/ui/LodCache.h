@@ -0,0 +1,45 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QPixmap>
+#include <vector>
+
+namespace dashboard {
+
+// Mip chain of one card's snapshot. Level 0 is the full-resolution grab;
+// each further level halves it and is built the first time it is needed.
+class LodCache {
+public:
+    void setBase(const QPixmap& base, quint64 generation);
+    void clear();
+
+    bool isEmpty() const;
+    quint64 generation() const;
+
+    // Smallest level that is still at least targetWidth device pixels wide.
+    const QPixmap& level(int targetWidth);
+    // Keeps only level(targetWidth), dropping the full-resolution grab
+    void trim(int targetWidth);
+
+    qint64 byteSize() const;
+
+private:
+    std::vector<QPixmap> levels_;
+    quint64 generation_ = 0;
+};
+
+}  // namespace dashboard
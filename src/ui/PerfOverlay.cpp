@@ -0,0 +1,373 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PerfOverlay.h"
+
+#include "ContentCache.h"
+#include "WidgetCanvas.h"
+#include "WidgetFrame.h"
+#include "core/HeapAccounting.h"
+#include "core/IdleScheduler.h"
+#include "core/ImageCache.h"
+#include "core/ProcessMemory.h"
+#include "core/WidgetManager.h"
+
+#include <QFile>
+#include <QFileDialog>
+#include <QPainter>
+#include <QSet>
+#include <QTextStream>
+#include <algorithm>
+
+namespace dashboard {
+
+static constexpr int kSampleIntervalMs = 1000;
+static constexpr int kMemorySampleEvery = 10;  // smaps is expensive to parse
+static constexpr int kPanelWidth = 600;
+static constexpr int kLineHeight = 16;
+static constexpr int kMaxRows = 12;
+static constexpr int kHeapRows = 5;
+static constexpr int kPadding = 12;
+
+static const std::array<int, kFrameBuckets> kFpsBounds{10, 20, 30, 45, 60, 0};
+
+PerfOverlay::PerfOverlay(WidgetCanvas& canvas, WidgetManager& widgetManager, int historyMinutes,
+                         QWidget* parent)
+    : QWidget(parent),
+      canvas_(canvas),
+      widgetManager_(widgetManager),
+      historySamples_(qMax(1, historyMinutes) * 60000 / kSampleIntervalMs) {
+    exportButton_ = new QPushButton("Export CSV…", this);
+    connect(exportButton_, &QPushButton::clicked, this, &PerfOverlay::chooseExportFile);
+
+    const int heapLines = HeapAccounting::kEnabled ? kHeapRows + 1 : 0;
+    setFixedSize(kPanelWidth, kPadding * 2 + kLineHeight * (12 + kMaxRows + heapLines) + 36);
+    exportButton_->move(width() - exportButton_->sizeHint().width() - kPadding,
+                        height() - exportButton_->sizeHint().height() - kPadding);
+
+    sampleTimer_.setInterval(kSampleIntervalMs);
+    connect(&sampleTimer_, &QTimer::timeout, this, [this]() { sample(); });
+}
+
+void PerfOverlay::showEvent(QShowEvent* event) {
+    QWidget::showEvent(event);
+    if (!sampleTimer_.isActive()) {
+        // Rates start from now rather than from when the overlay was last hidden
+        samplesUntilMemory_ = 0;
+        sample(false);
+        sampleTimer_.start();
+    }
+}
+
+void PerfOverlay::hideEvent(QHideEvent* event) {
+    QWidget::hideEvent(event);
+    sampleTimer_.stop();
+}
+
+void PerfOverlay::refreshMappedMemory() {
+    QStringList paths;
+    for (auto* frame : canvas_.frames()) {
+        QString path = widgetManager_.pluginFilePath(frame->iwidget());
+        if (!path.isEmpty() && !paths.contains(path)) {
+            paths.append(path);
+        }
+    }
+    mappedBytes_ = ProcessMemory::mappedResidentBytes(paths);
+}
+
+void PerfOverlay::sample(bool record) {
+    auto* monitor = PerfMonitor::instance();
+    if (!monitor) {
+        return;
+    }
+
+    const qint64 nowMs = QDateTime::currentMSecsSinceEpoch();
+    const double seconds = qMax<qint64>(1, nowMs - previousSampleMs_) / 1000.0;
+    previousSampleMs_ = nowMs;
+
+    if (samplesUntilMemory_-- <= 0) {
+        refreshMappedMemory();
+        samplesUntilMemory_ = kMemorySampleEvery;
+    }
+
+    Sample s;
+    s.time = QDateTime::fromMSecsSinceEpoch(nowMs);
+
+    // Frame times since the previous sample (bounded by the monitor's ring buffer)
+    const FrameStats& frames = monitor->frameStats();
+    const quint64 newFrames = frames.count - previousFrameCount_;
+    previousFrameCount_ = frames.count;
+    s.fps = newFrames / seconds;
+    const int n = int(qMin<quint64>(newFrames, kRecentFrames));
+    if (n > 0) {
+        std::vector<qint64> times(n);
+        for (int i = 0; i < n; ++i) {
+            times[i] = frames.recentNs[(frames.count - 1 - i) % kRecentFrames];
+        }
+        std::sort(times.begin(), times.end());
+        s.frameP50Ms = times[n / 2] / 1e6;
+        s.frameP95Ms = times[qMin(n - 1, n * 95 / 100)] / 1e6;
+    }
+
+    // Rebuilt each sample, so deleted cards drop out
+    QHash<QString, std::array<PluginCallStats, kPluginCallKinds>> calls;
+    QSet<QString> countedLibraries;
+    for (auto* frame : canvas_.frames()) {
+        if (frame->widgetId().isEmpty()) {
+            continue;
+        }
+        const InstanceStats* stats =
+            monitor->stats(frame, frame->pluginName(), frame->widgetId());
+        const auto previous = previousCalls_.value(frame->widgetId());
+        const auto& paint = stats->calls[int(PluginCall::Paint)];
+        const auto& event = stats->calls[int(PluginCall::Event)];
+
+        InstanceSample row;
+        row.instanceId = frame->widgetId();
+        row.pluginName = frame->pluginName();
+        row.paintMsPerSec = (paint.totalNs - previous[int(PluginCall::Paint)].totalNs) / 1e6 / seconds;
+        row.eventMsPerSec = (event.totalNs - previous[int(PluginCall::Event)].totalNs) / 1e6 / seconds;
+        row.updatesPerSec = (paint.count - previous[int(PluginCall::Paint)].count) / seconds;
+        if (QWidget* content = frame->contentWidget()) {
+            row.timers = int(content->findChildren<QTimer*>().size());
+            row.objects = int(content->findChildren<QObject*>().size()) + 1;
+        }
+        const QString library = widgetManager_.pluginFilePath(frame->iwidget());
+        row.sharedLibrary = countedLibraries.contains(library);
+        if (!row.sharedLibrary) {
+            row.mappedBytes = mappedBytes_.value(library);
+            countedLibraries.insert(library);
+        }
+        s.instances.append(row);
+
+        calls.insert(frame->widgetId(), stats->calls);
+    }
+    previousCalls_ = std::move(calls);
+
+    for (const HeapAccounting::Owner& owner : HeapAccounting::owners()) {
+        quint64& previous = previousAllocations_[owner.name];
+        s.heap.append({owner.name, owner.liveBytes, (owner.allocations - previous) / seconds});
+        previous = owner.allocations;
+    }
+
+    if (!record) {
+        return;
+    }
+    history_.push_back(std::move(s));
+    while (int(history_.size()) > historySamples_) {
+        history_.pop_front();
+    }
+
+    if (isVisible()) {
+        update();
+    }
+}
+
+void PerfOverlay::paintEvent(QPaintEvent* /*event*/) {
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(Qt::NoPen);
+    painter.setBrush(QColor(10, 10, 20, 225));
+    painter.drawRoundedRect(rect(), 8, 8);
+
+    QFont font("monospace");
+    font.setStyleHint(QFont::Monospace);
+    font.setPixelSize(11);
+    painter.setFont(font);
+
+    const QColor text(0xc8, 0xce, 0xe8);
+    const QColor bar(0x4a, 0x7a, 0xe0);
+    int y = kPadding + kLineHeight;
+
+    auto drawLine = [&](const QString& line, const QColor& color) {
+        painter.setPen(color);
+        painter.drawText(kPadding, y, line);
+        y += kLineHeight;
+    };
+
+    // Draws a labelled horizontal bar histogram on one line per bucket pair
+    auto drawHistogram = [&](const QString& title, const QStringList& labels,
+                             const QList<quint64>& counts) {
+        drawLine(title, QColor(0x88, 0x90, 0xb8));
+        quint64 max = 1;
+        for (quint64 c : counts) {
+            max = qMax(max, c);
+        }
+        const int barWidth = (kPanelWidth - kPadding * 2) / int(counts.size());
+        const int barMax = kLineHeight * 2;
+        for (int i = 0; i < counts.size(); ++i) {
+            int h = int(barMax * counts[i] / max);
+            int x = kPadding + i * barWidth;
+            painter.setPen(Qt::NoPen);
+            painter.setBrush(bar);
+            painter.drawRect(x + 2, y + barMax - h, barWidth - 4, h);
+            painter.setPen(text);
+            painter.drawText(QRect(x, y + barMax, barWidth, kLineHeight), Qt::AlignCenter,
+                             QString("%1 (%2)").arg(labels[i]).arg(counts[i]));
+        }
+        y += barMax + kLineHeight + 4;
+    };
+
+    const Sample* last = history_.empty() ? nullptr : &history_.back();
+    if (last) {
+        drawLine(QString("Frame time  p50 %1 ms   p95 %2 ms   %3 fps")
+                     .arg(last->frameP50Ms, 0, 'f', 1)
+                     .arg(last->frameP95Ms, 0, 'f', 1)
+                     .arg(last->fps, 0, 'f', 0),
+                 text);
+    }
+
+    {
+        const ContentCache::Stats cache = canvas_.contentCache().stats();
+        const quint64 paints = cache.hits + cache.misses;
+        drawLine(QString("Card snapshots  %1 resting   hit rate %2%   invalidated %3")
+                     .arg(cache.resting)
+                     .arg(paints ? 100.0 * cache.hits / paints : 0.0, 0, 'f', 0)
+                     .arg(cache.invalidations),
+                 text);
+    }
+
+    if (auto* idle = IdleScheduler::instance()) {
+        const IdleScheduler::Stats work = idle->stats();
+        drawLine(QString("Deferred work  %1 ms idle   %2 ms critical path   %3 pending")
+                     .arg(work.idleNs / 1000000)
+                     .arg(work.criticalNs / 1000000)
+                     .arg(work.pending),
+                 text);
+    }
+
+    if (auto* images = ImageCache::instance()) {
+        const ImageCache::Stats cache = images->stats();
+        const quint64 lookups = cache.hits + cache.misses;
+        drawLine(QString("Images  %1 cached   %2 MB   hit rate %3%   evicted %4")
+                     .arg(cache.images)
+                     .arg(cache.bytes / (1024.0 * 1024.0), 0, 'f', 1)
+                     .arg(lookups ? 100.0 * cache.hits / lookups : 0.0, 0, 'f', 0)
+                     .arg(cache.evictions),
+                 text);
+    }
+
+    if (auto* monitor = PerfMonitor::instance()) {
+        const auto& bounds = PerfMonitor::frameBucketBounds();
+        QStringList labels;
+        QList<quint64> counts;
+        for (int i = 0; i < kFrameBuckets; ++i) {
+            labels << (bounds[i] > 0 ? QString("<%1ms").arg(bounds[i])
+                                     : QString("≥%1ms").arg(bounds[i - 1]));
+            counts << monitor->frameStats().histogram[i];
+        }
+        drawHistogram("Frame time histogram", labels, counts);
+    }
+
+    {
+        QStringList labels;
+        QList<quint64> counts(kFrameBuckets, 0);
+        for (int i = 0; i < kFrameBuckets; ++i) {
+            labels << (kFpsBounds[i] > 0 ? QString("<%1").arg(kFpsBounds[i])
+                                         : QString("≥%1").arg(kFpsBounds[i - 1]));
+        }
+        for (const auto& s : history_) {
+            int bucket = kFrameBuckets - 1;
+            for (int i = 0; i < kFrameBuckets - 1; ++i) {
+                if (s.fps < kFpsBounds[i]) {
+                    bucket = i;
+                    break;
+                }
+            }
+            ++counts[bucket];
+        }
+        drawHistogram("Frame rate histogram (fps, per second)", labels, counts);
+    }
+
+    drawLine(QString("%1 %2 %3 %4 %5 %6 %7")
+                 .arg("Widget", -22)
+                 .arg("paint", 8)
+                 .arg("events", 8)
+                 .arg("upd/s", 7)
+                 .arg("timers", 7)
+                 .arg("objs", 6)
+                 .arg(".so RSS", 9),
+             QColor(0x88, 0x90, 0xb8));
+
+    if (last) {
+        QList<InstanceSample> rows = last->instances;
+        std::sort(rows.begin(), rows.end(), [](const auto& a, const auto& b) {
+            return a.paintMsPerSec + a.eventMsPerSec > b.paintMsPerSec + b.eventMsPerSec;
+        });
+        for (int i = 0; i < rows.size() && i < kMaxRows; ++i) {
+            const auto& r = rows[i];
+            drawLine(QString("%1 %2 %3 %4 %5 %6 %7")
+                         .arg(r.instanceId.left(22), -22)
+                         .arg(QString::number(r.paintMsPerSec, 'f', 1), 8)
+                         .arg(QString::number(r.eventMsPerSec, 'f', 1), 8)
+                         .arg(QString::number(r.updatesPerSec, 'f', 1), 7)
+                         .arg(r.timers, 7)
+                         .arg(r.objects, 6)
+                         .arg(r.sharedLibrary ? QString("shared")
+                                              : QString("%1K").arg(r.mappedBytes / 1024),
+                              9),
+                     text);
+        }
+    }
+
+    if (HeapAccounting::kEnabled) {
+        y = height() - kPadding - 36 - kLineHeight * kHeapRows;
+        drawLine(QString("%1 %2 %3").arg("Heap by plugin", -32).arg("live", 10).arg("alloc/s", 9),
+                 QColor(0x88, 0x90, 0xb8));
+        if (last) {
+            QList<HeapSample> rows = last->heap;
+            std::sort(rows.begin(), rows.end(),
+                      [](const auto& a, const auto& b) { return a.liveBytes > b.liveBytes; });
+            for (int i = 0; i < rows.size() && i < kHeapRows; ++i) {
+                drawLine(QString("%1 %2 %3")
+                             .arg(rows[i].pluginName.left(32), -32)
+                             .arg(QString("%1K").arg(rows[i].liveBytes / 1024), 10)
+                             .arg(QString::number(rows[i].allocationsPerSec, 'f', 0), 9),
+                         text);
+            }
+        }
+    }
+}
+
+void PerfOverlay::chooseExportFile() {
+    QString path = QFileDialog::getSaveFileName(this, "Export Performance History",
+                                                "dashboard-perf.csv", "CSV files (*.csv)");
+    if (!path.isEmpty()) {
+        exportCsv(path);
+    }
+}
+
+bool PerfOverlay::exportCsv(const QString& path) const {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+        return false;
+    }
+    QTextStream out(&file);
+    out << "time,scope,plugin,frame_p50_ms,frame_p95_ms,fps,paint_ms_per_s,event_ms_per_s,"
+           "updates_per_s,timers,qobjects,so_rss_kb\n";
+    for (const auto& s : history_) {
+        const QString time = s.time.toString(Qt::ISODate);
+        out << time << ",canvas,," << s.frameP50Ms << ',' << s.frameP95Ms << ',' << s.fps
+            << ",,,,,,\n";
+        for (const auto& r : s.instances) {
+            out << time << ',' << r.instanceId << ',' << r.pluginName << ",,,,"
+                << r.paintMsPerSec << ',' << r.eventMsPerSec << ',' << r.updatesPerSec << ','
+                << r.timers << ',' << r.objects << ',' << r.mappedBytes / 1024 << '\n';
+        }
+    }
+    return true;
+}
+
+}  // namespace dashboard
@@ -0,0 +1,102 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "core/PerfMonitor.h"
+
+#include <QDateTime>
+#include <QHash>
+#include <QPushButton>
+#include <QTimer>
+#include <QWidget>
+#include <deque>
+
+namespace dashboard {
+
+class WidgetCanvas;
+class WidgetManager;
+
+// Toggleable heads-up display over the canvas: frame time and frame rate
+// histograms plus per-instance paint/event cost, update rate, timers,
+// QObjects and mapped plugin memory, and live heap per plugin when heap
+// accounting is compiled in. Samples once per second while shown; the last
+// N minutes of samples can be exported as CSV.
+class PerfOverlay : public QWidget {
+    Q_OBJECT
+
+public:
+    PerfOverlay(WidgetCanvas& canvas, WidgetManager& widgetManager, int historyMinutes,
+                QWidget* parent = nullptr);
+
+    bool exportCsv(const QString& path) const;
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+    void showEvent(QShowEvent* event) override;
+    void hideEvent(QHideEvent* event) override;
+
+private:
+    struct InstanceSample {
+        QString instanceId;
+        QString pluginName;
+        double paintMsPerSec = 0;
+        double eventMsPerSec = 0;
+        double updatesPerSec = 0;
+        int timers = 0;
+        int objects = 0;
+        // The library's resident mappings, on the first card of each library only
+        qint64 mappedBytes = 0;
+        bool sharedLibrary = false;
+    };
+
+    struct HeapSample {
+        QString pluginName;
+        qint64 liveBytes = 0;
+        double allocationsPerSec = 0;
+    };
+
+    struct Sample {
+        QDateTime time;
+        double frameP50Ms = 0;
+        double frameP95Ms = 0;
+        double fps = 0;
+        QList<InstanceSample> instances;
+        QList<HeapSample> heap;
+    };
+
+    // record is false for the baseline taken when the overlay is shown
+    void sample(bool record = true);
+    void refreshMappedMemory();
+    void chooseExportFile();
+
+    WidgetCanvas& canvas_;
+    WidgetManager& widgetManager_;
+    int historySamples_;
+
+    QTimer sampleTimer_;
+    std::deque<Sample> history_;
+    QHash<QString, std::array<PluginCallStats, kPluginCallKinds>> previousCalls_;
+    QHash<QString, quint64> previousAllocations_;
+    quint64 previousFrameCount_ = 0;
+    qint64 previousSampleMs_ = 0;
+
+    QHash<QString, qint64> mappedBytes_;  // by plugin file path
+    int samplesUntilMemory_ = 0;
+
+    QPushButton* exportButton_;
+};
+
+}  // namespace dashboard
@@ -0,0 +1,114 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "PreviewCache.h"
+
+#include <QCoreApplication>
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QTimer>
+
+namespace dashboard {
+
+static constexpr int kMaxRunning = 2;
+// A widget that takes longer than this to appear gets no preview
+static constexpr int kRenderTimeoutMs = 5000;
+
+PreviewCache::PreviewCache(QObject* parent) : QObject(parent) {}
+
+PreviewCache::~PreviewCache() {
+    queue_.clear();
+    for (auto* process : findChildren<QProcess*>()) {
+        process->disconnect(this);
+        process->kill();
+        process->waitForFinished(500);
+    }
+}
+
+QString PreviewCache::cachePath(const PluginInfo& info) {
+    const QByteArray key = QCryptographicHash::hash(info.filePath.toUtf8() + '\0' + info.fileId,
+                                                    QCryptographicHash::Sha1)
+                               .toHex();
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/previews/"
+           + QString::fromLatin1(key) + ".png";
+}
+
+QPixmap PreviewCache::preview(const PluginInfo& info) {
+    // Built-in plugins have no library a helper could load
+    if (info.filePath.isEmpty()) {
+        return {};
+    }
+    const QString path = cachePath(info);
+    auto it = pixmaps_.constFind(path);
+    if (it != pixmaps_.cend()) {
+        return *it;
+    }
+    QPixmap pixmap;
+    if (QFile::exists(path) && pixmap.load(path)) {
+        pixmaps_.insert(path, pixmap);
+        return pixmap;
+    }
+    if (!pending_.contains(path)) {
+        pending_.append(path);
+        queue_.append({info.name, info.filePath, path});
+        startNext();
+    }
+    return {};
+}
+
+void PreviewCache::startNext() {
+    while (running_ < kMaxRunning && !queue_.isEmpty()) {
+        const Job job = queue_.takeFirst();
+        QDir().mkpath(QFileInfo(job.outputPath).absolutePath());
+
+        auto* process = new QProcess(this);
+        process->setProcessChannelMode(QProcess::ForwardedChannels);
+        connect(process, &QProcess::finished, this,
+                [this, process, job](int exitCode, QProcess::ExitStatus status) {
+                    onFinished(process, job, status == QProcess::NormalExit && exitCode == 0);
+                });
+        connect(process, &QProcess::errorOccurred, this,
+                [this, process, job](QProcess::ProcessError error) {
+                    if (error == QProcess::FailedToStart) {
+                        onFinished(process, job, false);
+                    }
+                });
+        QTimer::singleShot(kRenderTimeoutMs, process, &QProcess::kill);
+
+        ++running_;
+        process->start(QCoreApplication::applicationFilePath(),
+                       {"--render-preview", job.filePath, job.outputPath,
+                        QString("%1x%2").arg(kPreviewWidth).arg(kPreviewHeight)});
+    }
+}
+
+void PreviewCache::onFinished(QProcess* process, const Job& job, bool ok) {
+    process->deleteLater();
+    --running_;
+    // Failed renders stay pending so the dialog does not respawn them; retried next launch
+    QPixmap pixmap;
+    if (ok && pixmap.load(job.outputPath)) {
+        pending_.removeOne(job.outputPath);
+        pixmaps_.insert(job.outputPath, pixmap);
+        emit previewReady(job.pluginName, pixmap);
+    }
+    startNext();
+}
+
+}  // namespace dashboard
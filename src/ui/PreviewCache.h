@@ -0,0 +1,68 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "core/PluginIndex.h"
+
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPixmap>
+#include <QString>
+
+class QProcess;
+
+namespace dashboard {
+
+// Preview thumbnails of widget plugins for the Add Widget dialog, rendered by
+// `dashboard --render-preview` helper processes and cached on disk under
+// <CacheLocation>/previews, keyed by plugin file and its size and mtime.
+class PreviewCache : public QObject {
+    Q_OBJECT
+
+public:
+    // Largest thumbnail stored; the dialog scales down from it
+    static constexpr int kPreviewWidth = 192;
+    static constexpr int kPreviewHeight = 144;
+
+    explicit PreviewCache(QObject* parent = nullptr);
+    ~PreviewCache() override;
+
+    static QString cachePath(const PluginInfo& info);
+
+    // The cached thumbnail, or a null pixmap after queueing a render.
+    QPixmap preview(const PluginInfo& info);
+
+signals:
+    void previewReady(const QString& pluginName, const QPixmap& pixmap);
+
+private:
+    struct Job {
+        QString pluginName;
+        QString filePath;
+        QString outputPath;
+    };
+
+    void startNext();
+    void onFinished(QProcess* process, const Job& job, bool ok);
+
+    QList<Job> queue_;
+    QHash<QString, QPixmap> pixmaps_;
+    QList<QString> pending_;
+    int running_ = 0;
+};
+
+}  // namespace dashboard
@@ -0,0 +1,336 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "RemoteWidgetView.h"
+
+#include "core/ContentPause.h"
+#include "core/PowerProfile.h"
+
+#include <QCoreApplication>
+#include <QDataStream>
+#include <QDynamicPropertyChangeEvent>
+#include <QHash>
+#include <QKeyEvent>
+#include <QLocalSocket>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPointer>
+#include <QtMath>
+#include <QWheelEvent>
+#include <qlogging.h>
+
+namespace dashboard {
+
+static constexpr int kInitialRestartDelayMs = 1000;
+static constexpr int kMaxRestartDelayMs = 30000;
+// A retired helper gets this long to finish its last save and exit
+static constexpr int kRetireTimeoutMs = 3000;
+// Spare room in a new frame buffer, so growing a card while dragging its edge
+// reallocates a few times instead of on every step
+static constexpr double kFrameBufferHeadroom = 1.5;
+
+// Helpers of destroyed views that may still be saving, by instance ID
+static QHash<QString, QPointer<QProcess>>& retiringHelpers() {
+    static QHash<QString, QPointer<QProcess>> helpers;
+    return helpers;
+}
+
+RemoteWidgetView::RemoteWidgetView(const QString& pluginPath, QWidget* parent)
+    : QWidget(parent), pluginPath_(pluginPath), process_(new QProcess),
+      restartDelayMs_(kInitialRestartDelayMs) {
+    setFocusPolicy(Qt::StrongFocus);
+    setMouseTracking(true);
+
+    connect(&server_, &QLocalServer::newConnection, this, &RemoteWidgetView::onNewConnection);
+    connect(process_, &QProcess::finished, this, &RemoteWidgetView::onProcessFinished);
+
+    restartTimer_.setSingleShot(true);
+    connect(&restartTimer_, &QTimer::timeout, this, &RemoteWidgetView::launch);
+}
+
+RemoteWidgetView::~RemoteWidgetView() {
+    stopping_ = true;
+    process_->disconnect(this);
+    if (process_->state() == QProcess::NotRunning) {
+        delete process_;
+        return;
+    }
+    // The helper handles a Save sent earlier before Shutdown, so it writes its
+    // state and exits on its own. Nobody waits for it; a later view of the same
+    // instance launches once it is gone (see launch()).
+    if (channel_) {
+        channel_->send(HostMessage::Shutdown);
+        channel_->socket()->flush();
+    }
+    QProcess* helper = process_;
+    helper->setParent(QCoreApplication::instance());
+    retiringHelpers().insert(instanceId_, helper);
+    connect(helper, &QProcess::finished, helper, [helper, id = instanceId_]() {
+        if (retiringHelpers().value(id) == helper) {
+            retiringHelpers().remove(id);
+        }
+        helper->deleteLater();
+    });
+    QTimer::singleShot(kRetireTimeoutMs, helper, [helper]() { helper->kill(); });
+}
+
+void RemoteWidgetView::start(const QString& instanceId) {
+    instanceId_ = instanceId;
+    QString name = QString("dashboard-host-%1-%2")
+                       .arg(QCoreApplication::applicationPid())
+                       .arg(instanceId_);
+    QLocalServer::removeServer(name);
+    if (!server_.listen(name)) {
+        qWarning() << "Cannot listen for widget host:" << name << server_.errorString();
+        return;
+    }
+    launch();
+}
+
+void RemoteWidgetView::launch() {
+    connected_ = false;
+    frame_ = QImage();
+    update();
+
+    // The previous helper of this instance must finish its save before this one reads it
+    if (QProcess* previous = retiringHelpers().value(instanceId_)) {
+        connect(previous, &QObject::destroyed, this, &RemoteWidgetView::launch,
+                Qt::SingleShotConnection);
+        return;
+    }
+
+    QProcessEnvironment env = QProcessEnvironment::systemEnvironment();
+    env.insert("QT_QPA_PLATFORM", "offscreen");
+    process_->setProcessEnvironment(env);
+    process_->setProcessChannelMode(QProcess::ForwardedChannels);
+    process_->start(QCoreApplication::applicationFilePath(),
+                    {"--widget-host", pluginPath_, "--instance", instanceId_,
+                     "--server", server_.serverName()});
+}
+
+void RemoteWidgetView::onNewConnection() {
+    QLocalSocket* socket = server_.nextPendingConnection();
+    if (channel_) {
+        channel_->deleteLater();
+        channel_->socket()->deleteLater();
+    }
+    channel_ = new HostChannel(socket, this);
+    connect(channel_, &HostChannel::messageReceived, this, &RemoteWidgetView::onMessage);
+}
+
+void RemoteWidgetView::onMessage(HostMessage type, const QByteArray& /*payload*/) {
+    switch (type) {
+        case HostMessage::Hello:
+            connected_ = true;
+            restartDelayMs_ = kInitialRestartDelayMs;
+            allocateFrameBuffer();
+            sendPowerProfile();
+            break;
+        case HostMessage::FrameReady:
+            copyFrame();
+            break;
+        default:
+            break;
+    }
+}
+
+bool RemoteWidgetView::event(QEvent* event) {
+    // The canvas flags content widgets; pass it on to the widget in the helper
+    if (event->type() == QEvent::DynamicPropertyChange) {
+        const QByteArray name = static_cast<QDynamicPropertyChangeEvent*>(event)->propertyName();
+        if (name == PowerProfile::kLowPowerProperty || name == ContentPause::kFrozenProperty) {
+            sendPowerProfile();
+        }
+    }
+    return QWidget::event(event);
+}
+
+void RemoteWidgetView::sendPowerProfile() {
+    if (!connected_) {
+        return;
+    }
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    out << property(PowerProfile::kLowPowerProperty).toBool()
+        << property(ContentPause::kFrozenProperty).toBool();
+    channel_->send(HostMessage::PowerProfile, payload);
+}
+
+void RemoteWidgetView::onProcessFinished(int exitCode, QProcess::ExitStatus status) {
+    if (stopping_) {
+        return;
+    }
+    qWarning() << "Widget host for" << instanceId_ << "exited"
+               << (status == QProcess::CrashExit ? "(crashed)" : "") << "code" << exitCode
+               << "- restarting in" << restartDelayMs_ << "ms";
+    connected_ = false;
+    update();
+
+    // The restarted helper restores the last state it saved to WidgetDataStore
+    restartTimer_.start(restartDelayMs_);
+    restartDelayMs_ = qMin(restartDelayMs_ * 2, kMaxRestartDelayMs);
+}
+
+void RemoteWidgetView::requestSave() {
+    if (connected_) {
+        channel_->send(HostMessage::Save);
+    }
+}
+
+bool RemoteWidgetView::waitForSaved(int msecs) {
+    if (!connected_) {
+        return false;
+    }
+    return channel_->waitFor(HostMessage::Saved, msecs);
+}
+
+void RemoteWidgetView::allocateFrameBuffer() {
+    if (!connected_ || width() <= 0 || height() <= 0) {
+        return;
+    }
+
+    const qreal dpr = devicePixelRatioF();
+    const int pixelWidth = qCeil(width() * dpr);
+    const int pixelHeight = qCeil(height() * dpr);
+    const int bytesPerLine = pixelWidth * 4;
+    const qsizetype needed =
+        qsizetype(sizeof(SharedFrameHeader)) + qsizetype(bytesPerLine) * pixelHeight;
+
+    // The segment is kept while the frame fits. A new one gets a fresh key, and
+    // the helper detaches from the old one on Resize.
+    if (!shared_ || shared_->size() < needed) {
+        auto shared = std::make_unique<QSharedMemory>(
+            QString("dashboard-frame-%1-%2-%3")
+                .arg(QCoreApplication::applicationPid())
+                .arg(instanceId_)
+                .arg(++generation_));
+        if (!shared->create(qsizetype(needed * kFrameBufferHeadroom))) {
+            qWarning() << "Cannot allocate frame buffer for" << instanceId_ << shared->errorString();
+            return;
+        }
+        shared_ = std::move(shared);
+    }
+    shared_->lock();
+    auto* header = static_cast<SharedFrameHeader*>(shared_->data());
+    header->magic = kSharedFrameMagic;
+    header->width = quint32(pixelWidth);
+    header->height = quint32(pixelHeight);
+    header->bytesPerLine = quint32(bytesPerLine);
+    header->sequence = 0;
+    shared_->unlock();
+    frameSequence_ = 0;
+
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    out << size() << dpr << shared_->key();
+    channel_->send(HostMessage::Resize, payload);
+}
+
+void RemoteWidgetView::copyFrame() {
+    if (!shared_ || !shared_->lock()) {
+        return;
+    }
+    const auto* header = static_cast<const SharedFrameHeader*>(shared_->constData());
+    if (header->sequence != frameSequence_) {
+        frameSequence_ = header->sequence;
+        const auto* pixels =
+            static_cast<const uchar*>(shared_->constData()) + sizeof(SharedFrameHeader);
+        frame_ = QImage(pixels, int(header->width), int(header->height),
+                        int(header->bytesPerLine), QImage::Format_ARGB32_Premultiplied)
+                     .copy();
+        frame_.setDevicePixelRatio(devicePixelRatioF());
+    }
+    shared_->unlock();
+    update();
+}
+
+void RemoteWidgetView::paintEvent(QPaintEvent* /*event*/) {
+    QPainter painter(this);
+    if (!frame_.isNull()) {
+        painter.drawImage(0, 0, frame_);
+        return;
+    }
+    painter.setPen(palette().color(QPalette::PlaceholderText));
+    painter.drawText(rect(), Qt::AlignCenter,
+                     restartTimer_.isActive() ? "Widget stopped — restarting…"
+                                              : "Starting…");
+}
+
+void RemoteWidgetView::resizeEvent(QResizeEvent* event) {
+    QWidget::resizeEvent(event);
+    allocateFrameBuffer();
+}
+
+void RemoteWidgetView::forwardMouse(QMouseEvent* event) {
+    if (!connected_) {
+        return;
+    }
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    out << int(event->type()) << event->position() << int(event->button())
+        << int(event->buttons()) << int(event->modifiers());
+    channel_->send(HostMessage::Mouse, payload);
+    event->accept();
+}
+
+void RemoteWidgetView::forwardKey(QKeyEvent* event) {
+    if (!connected_) {
+        return;
+    }
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    out << int(event->type()) << event->key() << int(event->modifiers()) << event->text()
+        << event->isAutoRepeat();
+    channel_->send(HostMessage::Key, payload);
+    event->accept();
+}
+
+void RemoteWidgetView::mousePressEvent(QMouseEvent* event) {
+    forwardMouse(event);
+}
+
+void RemoteWidgetView::mouseReleaseEvent(QMouseEvent* event) {
+    forwardMouse(event);
+}
+
+void RemoteWidgetView::mouseDoubleClickEvent(QMouseEvent* event) {
+    forwardMouse(event);
+}
+
+void RemoteWidgetView::mouseMoveEvent(QMouseEvent* event) {
+    forwardMouse(event);
+}
+
+void RemoteWidgetView::wheelEvent(QWheelEvent* event) {
+    if (!connected_) {
+        return;
+    }
+    QByteArray payload;
+    QDataStream out(&payload, QIODevice::WriteOnly);
+    out << event->position() << event->pixelDelta() << event->angleDelta()
+        << int(event->buttons()) << int(event->modifiers());
+    channel_->send(HostMessage::Wheel, payload);
+    event->accept();
+}
+
+void RemoteWidgetView::keyPressEvent(QKeyEvent* event) {
+    forwardKey(event);
+}
+
+void RemoteWidgetView::keyReleaseEvent(QKeyEvent* event) {
+    forwardKey(event);
+}
+
+}  // namespace dashboard
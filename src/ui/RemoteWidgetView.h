@@ -0,0 +1,88 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "host/HostChannel.h"
+
+#include <QImage>
+#include <QLocalServer>
+#include <QProcess>
+#include <QSharedMemory>
+#include <QTimer>
+#include <QWidget>
+#include <memory>
+
+namespace dashboard {
+
+// Content widget for a plugin running in a separate `dashboard --widget-host`
+// process. Composites the frames the helper writes to shared memory, forwards
+// input over a local socket and restarts the helper if it crashes.
+class RemoteWidgetView : public QWidget {
+    Q_OBJECT
+
+public:
+    explicit RemoteWidgetView(const QString& pluginPath, QWidget* parent = nullptr);
+    ~RemoteWidgetView() override;
+
+    // Starts the helper for the given instance. Its state is restored from WidgetDataStore.
+    void start(const QString& instanceId);
+
+    // Asks the helper to serialize its widget into WidgetDataStore. Destroying
+    // the view afterwards does not wait: the helper saves, then exits.
+    void requestSave();
+    // Blocks until the helper confirms the last requestSave(); only for quitting.
+    bool waitForSaved(int msecs);
+
+protected:
+    bool event(QEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
+    void resizeEvent(QResizeEvent* event) override;
+    void mousePressEvent(QMouseEvent* event) override;
+    void mouseReleaseEvent(QMouseEvent* event) override;
+    void mouseDoubleClickEvent(QMouseEvent* event) override;
+    void mouseMoveEvent(QMouseEvent* event) override;
+    void wheelEvent(QWheelEvent* event) override;
+    void keyPressEvent(QKeyEvent* event) override;
+    void keyReleaseEvent(QKeyEvent* event) override;
+
+private:
+    void launch();
+    void onNewConnection();
+    void onMessage(HostMessage type, const QByteArray& payload);
+    void onProcessFinished(int exitCode, QProcess::ExitStatus status);
+    void allocateFrameBuffer();
+    void copyFrame();
+    void sendPowerProfile();
+    void forwardMouse(QMouseEvent* event);
+    void forwardKey(QKeyEvent* event);
+
+    QString pluginPath_;
+    QString instanceId_;
+    QLocalServer server_;
+    QProcess* process_;  // outlives the view while a retired helper saves
+    HostChannel* channel_ = nullptr;
+    std::unique_ptr<QSharedMemory> shared_;
+    int generation_ = 0;
+    QImage frame_;
+    quint64 frameSequence_ = 0;
+
+    QTimer restartTimer_;
+    int restartDelayMs_;
+    bool connected_ = false;
+    bool stopping_ = false;
+};
+
+}  // namespace dashboard
@@ -0,0 +1,210 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "RestorePipeline.h"
+
+#include "WidgetCanvas.h"
+#include "WidgetFrame.h"
+#include "core/TaskExecutor.h"
+#include "core/WidgetDataStore.h"
+#include "core/WidgetManager.h"
+
+#include <QEvent>
+#include <algorithm>
+#include <utility>
+
+namespace dashboard {
+
+static constexpr int kSliceBudgetMs = 8;
+// Cards whose state one pool task reads; small, so the visible ones arrive first
+static constexpr int kPrefetchBatch = 8;
+static constexpr const char* kQuarantinedWarning =
+    "Not loaded: this plugin stopped the dashboard during the last start";
+
+RestorePipeline::RestorePipeline(WidgetCanvas& canvas, WidgetManager& widgetManager,
+                                 QObject* parent)
+    : QObject(parent), canvas_(canvas), widgetManager_(widgetManager) {
+    sliceTimer_.setSingleShot(true);
+    sliceTimer_.setInterval(0);
+    connect(&sliceTimer_, &QTimer::timeout, this, &RestorePipeline::runSlice);
+}
+
+void RestorePipeline::start(const QList<WidgetFrame*>& placeholders) {
+    cancel();
+    if (placeholders.isEmpty()) {
+        return;
+    }
+
+    const QRect view = canvas_.visibleRect();
+    QList<WidgetFrame*> ordered = placeholders;
+    std::stable_sort(ordered.begin(), ordered.end(), [&view](WidgetFrame* a, WidgetFrame* b) {
+        bool aVisible = a->geometry().intersects(view);
+        bool bVisible = b->geometry().intersects(view);
+        if (aVisible != bVisible) {
+            return aVisible;
+        }
+        return a->width() * a->height() > b->width() * b->height();
+    });
+
+    visibleRemaining_ = 0;
+    for (auto* frame : ordered) {
+        queue_.append(frame);
+        if (frame->geometry().intersects(view)) {
+            ++visibleRemaining_;
+        }
+    }
+    loaded_ = 0;
+    firstPaintReported_ = false;
+    awaitingPaint_ = visibleRemaining_ == 0;
+    clock_.start();
+    canvas_.installEventFilter(this);
+    sliceTimer_.start();
+
+    if (!prefetchState_ || !TaskExecutor::instance()) {
+        return;
+    }
+    QStringList instanceIds;
+    for (auto* frame : ordered) {
+        instanceIds << frame->widgetId();
+    }
+    prefetching_ = QSet<QString>(instanceIds.cbegin(), instanceIds.cend());
+    prefetch(lifetime_, instanceIds, generation_);
+}
+
+Async RestorePipeline::prefetch(Lifetime lifetime, QStringList instanceIds, int generation) {
+    for (qsizetype i = 0; i < instanceIds.size() && !prefetching_.isEmpty(); i += kPrefetchBatch) {
+        auto states = co_await TaskExecutor::instance()->run(
+            TaskExecutor::Lane::Interactive, [batch = instanceIds.mid(i, kPrefetchBatch)]() {
+                QHash<QString, QJsonObject> result;
+                for (const QString& id : batch) {
+                    result.insert(id, WidgetDataStore::load(id));
+                }
+                return result;
+            });
+        if (generation != generation_) {
+            co_return;
+        }
+        for (auto it = states.cbegin(); it != states.cend(); ++it) {
+            // A card loaded meanwhile read its state itself and may have saved since
+            if (prefetching_.remove(it.key())) {
+                prefetched_.insert(it.key(), it.value());
+            }
+        }
+    }
+}
+
+void RestorePipeline::cancel() {
+    ++generation_;
+    sliceTimer_.stop();
+    queue_.clear();
+    deferred_.clear();
+    prefetched_.clear();
+    prefetching_.clear();
+    awaitingPaint_ = false;
+    canvas_.removeEventFilter(this);
+}
+
+bool RestorePipeline::isRunning() const {
+    return !queue_.isEmpty() || !deferred_.isEmpty();
+}
+
+void RestorePipeline::setPrefetchState(bool enabled) {
+    prefetchState_ = enabled;
+}
+
+QJsonObject RestorePipeline::takeState(const QString& instanceId) {
+    prefetching_.remove(instanceId);
+    auto it = prefetched_.constFind(instanceId);
+    if (it == prefetched_.constEnd()) {
+        return WidgetDataStore::load(instanceId);
+    }
+    // Only good once: later loads of the card read what it saved since
+    QJsonObject state = *it;
+    prefetched_.erase(it);
+    return state;
+}
+
+void RestorePipeline::runSlice() {
+    QElapsedTimer budget;
+    budget.start();
+    // Always make progress, even if a single createWidget exceeds the budget
+    do {
+        QPointer<WidgetFrame> frame = queue_.takeFirst();
+        if (frame && !firstPaintReported_ && widgetManager_.exceedsLoadBudget(frame->pluginName())) {
+            deferred_.append(frame);
+        } else if (frame) {
+            loadFrame(frame);
+        }
+        if (visibleRemaining_ > 0 && --visibleRemaining_ == 0) {
+            awaitingPaint_ = true;
+            canvas_.update();
+        }
+    } while (!queue_.isEmpty() && budget.elapsed() < kSliceBudgetMs);
+
+    if (!queue_.isEmpty()) {
+        sliceTimer_.start();
+        return;
+    }
+    if (!deferred_.isEmpty()) {
+        // Resumed once the first paint is reported
+        canvas_.update();
+        return;
+    }
+    prefetched_.clear();
+    prefetching_.clear();
+    emit finished(clock_.elapsed(), loaded_);
+    if (firstPaintReported_) {
+        canvas_.removeEventFilter(this);
+    }
+}
+
+void RestorePipeline::loadFrame(WidgetFrame* frame) {
+    if (widgetManager_.isQuarantined(frame->pluginName())) {
+        // A retry that is still quarantined keeps a single copy of the warning
+        frame->removeWarning(kQuarantinedWarning);
+        frame->addWarning(kQuarantinedWarning);
+        return;
+    }
+    frame->removeWarning(kQuarantinedWarning);
+    // The plugin may have gone away since the layout was saved; keep its layout and state
+    IWidget* plugin = widgetManager_.findByName(frame->pluginName());
+    if (!plugin) {
+        canvas_.unloadWidget(frame);
+        return;
+    }
+    canvas_.loadContent(frame, plugin);
+    ++loaded_;
+}
+
+bool RestorePipeline::eventFilter(QObject* watched, QEvent* event) {
+    // The canvas paints first in a frame; report once the rest of that frame is done
+    if (watched == &canvas_ && event->type() == QEvent::Paint && awaitingPaint_
+        && !firstPaintReported_) {
+        firstPaintReported_ = true;
+        awaitingPaint_ = false;
+        QTimer::singleShot(0, this, [this, ms = clock_.elapsed()]() {
+            emit firstMeaningfulPaint(ms);
+            if (!deferred_.isEmpty()) {
+                queue_.append(std::exchange(deferred_, {}));
+                sliceTimer_.start();
+            } else if (queue_.isEmpty()) {
+                canvas_.removeEventFilter(this);
+            }
+        });
+    }
+    return QObject::eventFilter(watched, event);
+}
+
+}  // namespace dashboard
@@ -0,0 +1,89 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "core/Async.h"
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QJsonObject>
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QStringList>
+#include <QTimer>
+
+namespace dashboard {
+
+class WidgetCanvas;
+class WidgetFrame;
+class WidgetManager;
+
+// Turns placeholder cards into real widgets across event-loop iterations.
+// Each slice creates widgets until its time budget is spent, visible cards
+// first and larger ones before smaller, so the window stays responsive and
+// the part the user is looking at fills in first. Cards of plugins over the
+// load budget wait until that part has painted; cards of quarantined plugins
+// stay placeholders. Saved widget state is read ahead on the host thread pool
+// in small batches in the same order; a card whose state has not arrived yet
+// reads it itself.
+class RestorePipeline : public QObject {
+    Q_OBJECT
+
+public:
+    RestorePipeline(WidgetCanvas& canvas, WidgetManager& widgetManager, QObject* parent = nullptr);
+
+    void start(const QList<WidgetFrame*>& placeholders);
+    void cancel();
+    bool isRunning() const;
+
+    // Reads saved state on the pool before loading (TaskExecutor). On by default.
+    void setPrefetchState(bool enabled);
+    // The saved state of a card this restore is loading, read ahead when possible
+    QJsonObject takeState(const QString& instanceId);
+
+signals:
+    // Every card that was visible at start has content and has been painted.
+    void firstMeaningfulPaint(qint64 msSinceStart);
+    void finished(qint64 msSinceStart, int widgetCount);
+
+protected:
+    bool eventFilter(QObject* watched, QEvent* event) override;
+
+private:
+    Async prefetch(Lifetime lifetime, QStringList instanceIds, int generation);
+    void runSlice();
+    void loadFrame(WidgetFrame* frame);
+
+    WidgetCanvas& canvas_;
+    WidgetManager& widgetManager_;
+    QList<QPointer<WidgetFrame>> queue_;
+    QList<QPointer<WidgetFrame>> deferred_;
+    QHash<QString, QJsonObject> prefetched_;
+    QSet<QString> prefetching_;  // not loaded yet; their read-ahead is still wanted
+    bool prefetchState_ = true;
+    Lifetime lifetime_{this};
+    int generation_ = 0;  // bumped by cancel(); a stale prefetch is dropped
+    int visibleRemaining_ = 0;
+    int loaded_ = 0;
+    bool awaitingPaint_ = false;
+    bool firstPaintReported_ = false;
+    QElapsedTimer clock_;
+    QTimer sliceTimer_;
+};
+
+}  // namespace dashboard
@@ -15,6 +15,7 @@
 
 #include "SettingsDialog.h"
 
+#include "Theme.h"
 #include "core/ConfigStore.h"
 
 #include <QColorDialog>
@@ -23,6 +24,7 @@
 #include <QGroupBox>
 #include <QHBoxLayout>
 #include <QLabel>
+#include <QPainter>
 #include <QVBoxLayout>
 
 namespace dashboard {
@@ -47,6 +49,7 @@ void SettingsDialog::setupUi() {
     auto* colorRow = new QHBoxLayout();
     colorButton_ = new QPushButton(bgGroup);
     colorButton_->setFixedSize(60, 24);
+    colorButton_->setIconSize(QSize(44, 12));
     colorRow->addWidget(colorRadio_);
     colorRow->addWidget(colorButton_);
     colorRow->addStretch();
@@ -104,8 +107,66 @@ void SettingsDialog::setupUi() {
     titleBarRow->addWidget(titleBarHeightLabel_);
     winLayout->addLayout(titleBarRow);
 
+    keepRunningCheck_ = new QCheckBox("Keep running in the background when closed", winGroup);
+    keepRunningCheck_->setToolTip("Launching the dashboard again shows the window instantly.");
+    winLayout->addWidget(keepRunningCheck_);
+
     mainLayout->addWidget(winGroup);
 
+    // Appearance group
+    auto* appearanceGroup = new QGroupBox("Appearance", this);
+    auto* appearanceLayout = new QVBoxLayout(appearanceGroup);
+    auto* themeRow = new QHBoxLayout;
+    themeRow->addWidget(new QLabel("Theme", appearanceGroup));
+    themeCombo_ = new QComboBox(appearanceGroup);
+    for (const auto& name : Theme::names()) {
+        themeCombo_->addItem(name.at(0).toUpper() + name.mid(1), name);
+    }
+    themeRow->addWidget(themeCombo_, 1);
+    appearanceLayout->addLayout(themeRow);
+
+    auto* powerRow = new QHBoxLayout;
+    powerRow->addWidget(new QLabel("Rendering", appearanceGroup));
+    powerCombo_ = new QComboBox(appearanceGroup);
+    powerCombo_->addItem("Low power on battery", "auto");
+    powerCombo_->addItem("Always full quality", "normal");
+    powerCombo_->addItem("Always low power", "low");
+    powerCombo_->setToolTip(
+        "Low power drops card shadows and smooth scaling, caps the frame rate and asks "
+        "widgets to refresh less often.");
+    powerRow->addWidget(powerCombo_, 1);
+    appearanceLayout->addLayout(powerRow);
+
+    mainLayout->addWidget(appearanceGroup);
+
+    // Widgets group
+    auto* widgetsGroup = new QGroupBox("Widgets", this);
+    auto* widgetsLayout = new QVBoxLayout(widgetsGroup);
+    isolatedCheck_ = new QCheckBox("Run each widget in a separate process", widgetsGroup);
+    isolatedCheck_->setToolTip(
+        "A crashing or slow widget no longer affects the dashboard. Applies after restart.");
+    widgetsLayout->addWidget(isolatedCheck_);
+
+    auto* canvasSizeRow = new QHBoxLayout;
+    canvasSizeRow->addWidget(new QLabel("Canvas size", widgetsGroup));
+    canvasSizeSpin_ = new QSpinBox(widgetsGroup);
+    canvasSizeSpin_->setRange(1, 8);
+    canvasSizeSpin_->setSuffix(" \u00d7 window");
+    canvasSizeSpin_->setToolTip("Larger canvases scroll inside the window.");
+    canvasSizeRow->addWidget(canvasSizeSpin_, 1);
+    widgetsLayout->addLayout(canvasSizeRow);
+
+    auto* offscreenRow = new QHBoxLayout;
+    offscreenRow->addWidget(new QLabel("Widgets out of view", widgetsGroup));
+    offscreenCombo_ = new QComboBox(widgetsGroup);
+    offscreenCombo_->addItem("Keep running", "live");
+    offscreenCombo_->addItem("Pause and show a snapshot", "snapshot");
+    offscreenCombo_->addItem("Unload until scrolled into view", "unload");
+    offscreenRow->addWidget(offscreenCombo_, 1);
+    widgetsLayout->addLayout(offscreenRow);
+
+    mainLayout->addWidget(widgetsGroup);
+
     // Dialog buttons
     auto* buttons =
         new QDialogButtonBox(QDialogButtonBox::Ok | QDialogButtonBox::Cancel, this);
@@ -135,9 +196,9 @@ void SettingsDialog::setupUi() {
 }
 
 void SettingsDialog::loadFromConfig() {
-    QString mode = config_.value("background/mode", "color").toString();
-    selectedColor_ = QColor(config_.value("background/color", "#1a1a2a").toString());
-    QString path = config_.value("background/imagePath", "").toString();
+    QString mode = config_.get(config::backgroundMode);
+    selectedColor_ = QColor(config_.get(config::backgroundColor));
+    QString path = config_.get(config::backgroundImagePath);
 
     if (mode == "image") {
         imageRadio_->setChecked(true);
@@ -145,41 +206,53 @@ void SettingsDialog::loadFromConfig() {
         colorRadio_->setChecked(true);
     }
 
-    // Update color button preview
-    colorButton_->setStyleSheet(
-        QString("background-color: %1; border: 1px solid #4a4a6a; border-radius: 4px;")
-            .arg(selectedColor_.name()));
+    updateColorPreview();
 
     imagePath_->setText(path);
 
-    int opacity = config_.value("background/opacity", 100).toInt();
+    int opacity = config_.get(config::backgroundOpacity);
     opacitySlider_->setValue(opacity);
     opacityLabel_->setText(QString("%1%").arg(opacity));
 
-    int sizePercent = config_.value("window/sizePercent", 60).toInt();
+    int sizePercent = config_.get(config::windowSizePercent);
     sizeSlider_->setValue(sizePercent);
     sizeLabel_->setText(QString("%1%").arg(sizePercent));
 
-    int titleBarHeight = config_.value("window/titleBarHeight", 36).toInt();
+    int titleBarHeight = config_.get(config::titleBarHeight);
     titleBarHeightSlider_->setValue(titleBarHeight);
     titleBarHeightLabel_->setText(QString("%1px").arg(titleBarHeight));
+
+    int themeIndex = themeCombo_->findData(config_.get(config::theme));
+    themeCombo_->setCurrentIndex(qMax(0, themeIndex));
+    int powerIndex = powerCombo_->findData(config_.get(config::powerProfile));
+    powerCombo_->setCurrentIndex(qMax(0, powerIndex));
+
+    keepRunningCheck_->setChecked(config_.get(config::keepRunning));
+    isolatedCheck_->setChecked(config_.get(config::isolatedWidgets));
+    canvasSizeSpin_->setValue(config_.get(config::canvasSizeFactor));
+    int offscreenIndex =
+        offscreenCombo_->findData(config_.get(config::canvasOffscreen));
+    offscreenCombo_->setCurrentIndex(qMax(0, offscreenIndex));
 }
 
 void SettingsDialog::apply() {
-    if (colorRadio_->isChecked()) {
-        config_.setValue("background/mode", "color");
-    } else {
-        config_.setValue("background/mode", "image");
+    // Listeners see one change notification covering only the keys that differ
+    {
+        ConfigStore::Batch batch(config_);
+        config_.set(config::backgroundMode,
+                    QString(colorRadio_->isChecked() ? "color" : "image"));
+        config_.set(config::backgroundColor, selectedColor_.name());
+        config_.set(config::backgroundImagePath, imagePath_->text());
+        config_.set(config::backgroundOpacity, opacitySlider_->value());
+        config_.set(config::windowSizePercent, sizeSlider_->value());
+        config_.set(config::titleBarHeight, titleBarHeightSlider_->value());
+        config_.set(config::theme, themeCombo_->currentData().toString());
+        config_.set(config::powerProfile, powerCombo_->currentData().toString());
+        config_.set(config::keepRunning, keepRunningCheck_->isChecked());
+        config_.set(config::isolatedWidgets, isolatedCheck_->isChecked());
+        config_.set(config::canvasSizeFactor, canvasSizeSpin_->value());
+        config_.set(config::canvasOffscreen, offscreenCombo_->currentData().toString());
     }
-    config_.setValue("background/color", selectedColor_.name());
-    config_.setValue("background/imagePath", imagePath_->text());
-    config_.setValue("background/opacity", opacitySlider_->value());
-    config_.setValue("window/sizePercent", sizeSlider_->value());
-    config_.setValue("window/titleBarHeight", titleBarHeightSlider_->value());
-
-    emit backgroundChanged();
-    emit windowSizeChanged();
-    emit titleBarHeightChanged();
     accept();
 }
 
@@ -187,11 +260,20 @@ void SettingsDialog::chooseColor() {
     QColor color = QColorDialog::getColor(selectedColor_, this, "Choose Background Color");
     if (color.isValid()) {
         selectedColor_ = color;
-        colorButton_->setStyleSheet(
-            QString("background-color: %1; border: 1px solid gray;").arg(color.name()));
+        updateColorPreview();
     }
 }
 
+void SettingsDialog::updateColorPreview() {
+    QPixmap swatch(colorButton_->iconSize());
+    swatch.fill(selectedColor_);
+    QPainter painter(&swatch);
+    painter.setPen(Theme::current().border);
+    painter.drawRect(swatch.rect().adjusted(0, 0, -1, -1));
+    painter.end();
+    colorButton_->setIcon(QIcon(swatch));
+}
+
 void SettingsDialog::chooseImage() {
     QString path = QFileDialog::getOpenFileName(
         this, "Choose Background Image", QString(),
@@ -15,13 +15,16 @@
 
 #pragma once
 
+#include <QCheckBox>
 #include <QColor>
+#include <QComboBox>
 #include <QDialog>
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
 #include <QRadioButton>
 #include <QSlider>
+#include <QSpinBox>
 #include <QString>
 
 namespace dashboard {
@@ -34,11 +37,6 @@ class SettingsDialog : public QDialog {
 public:
     explicit SettingsDialog(ConfigStore& config, QWidget* parent = nullptr);
 
-signals:
-    void backgroundChanged();
-    void windowSizeChanged();
-    void titleBarHeightChanged();
-
 private:
     void setupUi();
     void loadFromConfig();
@@ -46,6 +44,7 @@ private:
 
     void chooseColor();
     void chooseImage();
+    void updateColorPreview();
 
     ConfigStore& config_;
 
@@ -64,6 +63,15 @@ private:
 
     QSlider* titleBarHeightSlider_;
     QLabel* titleBarHeightLabel_;
+
+    QComboBox* themeCombo_;
+    QComboBox* powerCombo_;
+
+    QCheckBox* keepRunningCheck_;
+
+    QCheckBox* isolatedCheck_;
+    QSpinBox* canvasSizeSpin_;
+    QComboBox* offscreenCombo_;
 };
 
 }  // namespace dashboard
@@ -0,0 +1,161 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "StartupSnapshot.h"
+
+#include "WidgetCanvas.h"
+#include "WidgetFrame.h"
+
+#include <QDir>
+#include <QFile>
+#include <QImageReader>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QPainter>
+#include <QScreen>
+#include <QStandardPaths>
+
+namespace dashboard {
+
+static constexpr int kJpegQuality = 85;
+static constexpr int kFadeMs = 200;
+static constexpr int kFadeStepMs = 16;
+
+static QString snapshotPath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+           + "/startup-snapshot.jpg";
+}
+
+static QString sidecarPath() {
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+           + "/startup-snapshot.json";
+}
+
+static QJsonArray rectToJson(const QRect& rect) {
+    return {rect.x(), rect.y(), rect.width(), rect.height()};
+}
+
+// Everything that must match for the old pixels to be where the new widgets will be
+static QJsonObject describeView(const WidgetCanvas& canvas, const QByteArray& tag) {
+    QJsonObject obj;
+    obj["visible"] = rectToJson(canvas.visibleRect());
+    obj["dpr"] = canvas.devicePixelRatioF();
+    QScreen* screen = canvas.screen();
+    obj["screen"] = rectToJson(screen ? screen->geometry() : QRect());
+    obj["tag"] = QString::fromLatin1(tag.toHex());
+    return obj;
+}
+
+void StartupSnapshot::save(WidgetCanvas& canvas, const QByteArray& tag) {
+    QDir().mkpath(QFileInfo(snapshotPath()).absolutePath());
+    QPixmap pixmap = canvas.grab(canvas.visibleRect());
+    if (pixmap.isNull() || !pixmap.save(snapshotPath(), "JPG", kJpegQuality)) {
+        return;
+    }
+    QFile sidecar(sidecarPath());
+    if (sidecar.open(QIODevice::WriteOnly)) {
+        sidecar.write(QJsonDocument(describeView(canvas, tag)).toJson(QJsonDocument::Compact));
+    }
+}
+
+StartupSnapshot* StartupSnapshot::restore(WidgetCanvas& canvas, const QByteArray& tag,
+                                          QWidget* viewport) {
+    QFile sidecar(sidecarPath());
+    if (!sidecar.open(QIODevice::ReadOnly)) {
+        return nullptr;
+    }
+    QJsonObject saved = QJsonDocument::fromJson(sidecar.readAll()).object();
+    if (saved != describeView(canvas, tag)) {
+        return nullptr;
+    }
+
+    QImageReader reader(snapshotPath());
+    QImage image = reader.read();
+    if (image.isNull()) {
+        return nullptr;
+    }
+    QPixmap pixmap = QPixmap::fromImage(std::move(image));
+    pixmap.setDevicePixelRatio(canvas.devicePixelRatioF());
+
+    auto* snapshot = new StartupSnapshot(pixmap, viewport);
+    const QPoint origin = canvas.pos();
+    for (auto* frame : canvas.frames()) {
+        snapshot->regions_.append({frame, frame->geometry().translated(origin)});
+    }
+    snapshot->show();
+    snapshot->raise();
+    return snapshot;
+}
+
+StartupSnapshot::StartupSnapshot(const QPixmap& pixmap, QWidget* viewport)
+    : QWidget(viewport), pixmap_(pixmap) {
+    setAttribute(Qt::WA_TransparentForMouseEvents);
+    setGeometry(viewport->rect());
+
+    fadeTimer_.setInterval(kFadeStepMs);
+    connect(&fadeTimer_, &QTimer::timeout, this, &StartupSnapshot::stepFade);
+}
+
+void StartupSnapshot::reveal(WidgetFrame* frame) {
+    for (auto& region : regions_) {
+        if (region.frame == frame) {
+            region.fading = true;
+        }
+    }
+    if (!fadeTimer_.isActive()) {
+        fadeTimer_.start();
+    }
+}
+
+void StartupSnapshot::revealAll() {
+    for (auto& region : regions_) {
+        region.fading = true;
+    }
+    if (!fadeTimer_.isActive()) {
+        fadeTimer_.start();
+    }
+}
+
+void StartupSnapshot::stepFade() {
+    const qreal step = qreal(kFadeStepMs) / kFadeMs;
+    for (auto it = regions_.begin(); it != regions_.end();) {
+        if (it->fading || !it->frame) {
+            it->opacity -= step;
+        }
+        if (it->opacity <= 0 || !it->frame) {
+            it = regions_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    update();
+    if (regions_.isEmpty()) {
+        deleteLater();
+    }
+}
+
+void StartupSnapshot::paintEvent(QPaintEvent* /*event*/) {
+    // Only cards are drawn from the snapshot; the live canvas already paints the background
+    QPainter painter(this);
+    const qreal dpr = pixmap_.devicePixelRatio();
+    for (const auto& region : regions_) {
+        painter.setOpacity(region.opacity);
+        QRectF source(QPointF(region.rect.topLeft()) * dpr, QSizeF(region.rect.size()) * dpr);
+        painter.drawPixmap(QRectF(region.rect), pixmap_, source);
+    }
+}
+
+}  // namespace dashboard
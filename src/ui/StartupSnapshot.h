@@ -0,0 +1,64 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QList>
+#include <QPixmap>
+#include <QPointer>
+#include <QTimer>
+#include <QWidget>
+
+namespace dashboard {
+
+class WidgetCanvas;
+class WidgetFrame;
+
+// Last frame of the previous session, painted over placeholder cards until
+// the real widgets exist. Stored as a JPEG plus a JSON sidecar holding the
+// view size, device pixel ratio, screen geometry and a caller-supplied tag
+// (layout and appearance); any mismatch discards it.
+class StartupSnapshot : public QWidget {
+    Q_OBJECT
+
+public:
+    static void save(WidgetCanvas& canvas, const QByteArray& tag);
+    // Returns nullptr if there is no usable snapshot for this view.
+    static StartupSnapshot* restore(WidgetCanvas& canvas, const QByteArray& tag, QWidget* viewport);
+
+    // Cross-fades one card from the snapshot to the live widget.
+    void reveal(WidgetFrame* frame);
+    void revealAll();
+
+protected:
+    void paintEvent(QPaintEvent* event) override;
+
+private:
+    struct Region {
+        QPointer<WidgetFrame> frame;
+        QRect rect;
+        qreal opacity = 1.0;
+        bool fading = false;
+    };
+
+    StartupSnapshot(const QPixmap& pixmap, QWidget* viewport);
+    void stepFade();
+
+    QPixmap pixmap_;
+    QList<Region> regions_;
+    QTimer fadeTimer_;
+};
+
+}  // namespace dashboard
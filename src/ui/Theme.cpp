@@ -0,0 +1,133 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "Theme.h"
+
+#include "ThemeStyle.h"
+
+#include <QApplication>
+#include <QFont>
+
+namespace dashboard {
+
+static Theme s_current = Theme::dark();
+
+Theme Theme::dark() {
+    Theme t;
+    t.name = "dark";
+    t.window = QColor(0x1e, 0x1e, 0x2e);
+    t.base = QColor(0x15, 0x15, 0x1f);
+    t.surface = QColor(0x26, 0x26, 0x3a);
+    t.cardBorder = QColor(0x3e, 0x3e, 0x60);
+    t.border = QColor(0x3a, 0x3a, 0x5c);
+    t.text = QColor(0xc8, 0xce, 0xe8);
+    t.mutedText = QColor(0x70, 0x70, 0x90);
+    t.placeholderText = QColor(0x70, 0x78, 0x8a);
+    t.accent = QColor(0x3a, 0x6a, 0xcc);
+    t.accentHover = QColor(0x4a, 0x7a, 0xe0);
+    t.accentPressed = QColor(0x2c, 0x5a, 0xa8);
+    t.hover = QColor(0x2d, 0x2d, 0x4a);
+    t.danger = QColor(0xc0, 0x39, 0x2b);
+    t.warning = QColor(0xf0, 0xc0, 0x40);
+    t.warningBackground = QColor(0x4a, 0x3a, 0x20);
+    t.titleBar = QColor(0x18, 0x18, 0x25);
+    t.titleText = QColor(0xa0, 0xa8, 0xd0);
+    t.chromeButton = QColor(0x36, 0x36, 0x4e);
+    t.chromeButtonText = QColor(0xa0, 0xa8, 0xc8);
+    return t;
+}
+
+Theme Theme::light() {
+    Theme t;
+    t.name = "light";
+    t.window = QColor(0xee, 0xf0, 0xf6);
+    t.base = QColor(0xff, 0xff, 0xff);
+    t.surface = QColor(0xfa, 0xfb, 0xfe);
+    t.cardBorder = QColor(0xd0, 0xd4, 0xe4);
+    t.border = QColor(0xc4, 0xc8, 0xda);
+    t.text = QColor(0x24, 0x28, 0x3c);
+    t.mutedText = QColor(0x70, 0x74, 0x90);
+    t.placeholderText = QColor(0x90, 0x94, 0xa8);
+    t.accent = QColor(0x3a, 0x6a, 0xcc);
+    t.accentHover = QColor(0x4a, 0x7a, 0xe0);
+    t.accentPressed = QColor(0x2c, 0x5a, 0xa8);
+    t.hover = QColor(0xdc, 0xe0, 0xf0);
+    t.danger = QColor(0xd0, 0x40, 0x40);
+    t.warning = QColor(0x8a, 0x60, 0x00);
+    t.warningBackground = QColor(0xfa, 0xe8, 0xb0);
+    t.titleBar = QColor(0xe2, 0xe5, 0xef);
+    t.titleText = QColor(0x40, 0x46, 0x68);
+    t.chromeButton = QColor(0xe0, 0xe3, 0xee);
+    t.chromeButtonText = QColor(0x50, 0x56, 0x78);
+    return t;
+}
+
+Theme Theme::byName(const QString& name) {
+    return name == "light" ? light() : dark();
+}
+
+QStringList Theme::names() {
+    return {"dark", "light"};
+}
+
+const Theme& Theme::current() {
+    return s_current;
+}
+
+QPalette Theme::palette() const {
+    QPalette p;
+    p.setColor(QPalette::Window, window);
+    p.setColor(QPalette::WindowText, text);
+    p.setColor(QPalette::Base, base);
+    p.setColor(QPalette::AlternateBase, surface);
+    p.setColor(QPalette::Text, text);
+    p.setColor(QPalette::Button, surface);
+    p.setColor(QPalette::ButtonText, text);
+    p.setColor(QPalette::BrightText, Qt::white);
+    p.setColor(QPalette::Highlight, accentHover);
+    p.setColor(QPalette::HighlightedText, Qt::white);
+    p.setColor(QPalette::ToolTipBase, surface);
+    p.setColor(QPalette::ToolTipText, text);
+    p.setColor(QPalette::PlaceholderText, placeholderText);
+    p.setColor(QPalette::Link, accentHover);
+    p.setColor(QPalette::Light, surface.lighter(130));
+    p.setColor(QPalette::Midlight, surface.lighter(115));
+    p.setColor(QPalette::Mid, border);
+    p.setColor(QPalette::Dark, window.darker(130));
+    p.setColor(QPalette::Shadow, Qt::black);
+    p.setColor(QPalette::Disabled, QPalette::WindowText, mutedText);
+    p.setColor(QPalette::Disabled, QPalette::Text, mutedText);
+    p.setColor(QPalette::Disabled, QPalette::ButtonText, mutedText);
+    return p;
+}
+
+void Theme::apply(QApplication& app, const Theme& theme) {
+    s_current = theme;
+
+    auto* style = qobject_cast<ThemeStyle*>(app.style());
+    if (!style) {
+        QFont font = app.font();
+        font.setFamilies({"Inter", "Segoe UI", "SF Pro Text", "Arial"});
+        font.setPixelSize(13);
+        app.setFont(font);
+
+        style = new ThemeStyle;
+        app.setStyle(style);  // takes ownership
+    }
+    style->setTheme(theme);
+    app.setPalette(theme.palette());
+}
+
+}  // namespace dashboard
@@ -0,0 +1,70 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include <QColor>
+#include <QPalette>
+#include <QString>
+#include <QStringList>
+
+class QApplication;
+
+namespace dashboard {
+
+// Colors of the dashboard chrome, compiled into the binary instead of parsed
+// from a style sheet. Widgets read Theme::current() when they paint, so a
+// theme switch only needs the palette change Qt already broadcasts.
+struct Theme {
+    QString name;
+
+    QColor window;          // dialogs, main window
+    QColor base;            // input fields, lists
+    QColor surface;         // menus, buttons, widget cards
+    QColor cardBorder;
+    QColor border;
+    QColor text;
+    QColor mutedText;
+    QColor placeholderText;
+    QColor accent;
+    QColor accentHover;
+    QColor accentPressed;
+    QColor hover;           // hovered flat buttons and menu items
+    QColor danger;
+    QColor warning;
+    QColor warningBackground;
+    QColor titleBar;
+    QColor titleText;
+    QColor chromeButton;    // round buttons overlaid on cards
+    QColor chromeButtonText;
+
+    int cardRadius = 10;
+    int controlRadius = 6;
+
+    static Theme dark();
+    static Theme light();
+    static Theme byName(const QString& name);
+    static QStringList names();
+
+    static const Theme& current();
+
+    // Installs the ThemeStyle and palette on first use; later calls only swap
+    // colors, which repaints widgets without re-polishing them.
+    static void apply(QApplication& app, const Theme& theme);
+
+    QPalette palette() const;
+};
+
+}  // namespace dashboard
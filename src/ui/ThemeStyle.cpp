@@ -0,0 +1,139 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#include "ThemeStyle.h"
+
+#include <QPainter>
+#include <QStyleOptionButton>
+
+namespace dashboard {
+
+ThemeStyle::ThemeStyle() : QProxyStyle("Fusion") {
+    setTheme(Theme::current());
+}
+
+void ThemeStyle::setTheme(const Theme& theme) {
+    theme_ = theme;
+    buttonBrush_ = QBrush(theme.surface);
+    buttonHoverBrush_ = QBrush(theme.hover);
+    buttonPressedBrush_ = QBrush(theme.window.darker(110));
+    defaultBrush_ = QBrush(theme.accent);
+    defaultHoverBrush_ = QBrush(theme.accentHover);
+    defaultPressedBrush_ = QBrush(theme.accentPressed);
+    disabledBrush_ = QBrush(theme.window);
+    baseBrush_ = QBrush(theme.base);
+    surfaceBrush_ = QBrush(theme.surface);
+    borderPen_ = QPen(theme.border, 1);
+    hoverBorderPen_ = QPen(theme.accentHover.darker(130), 1);
+    focusPen_ = QPen(theme.accentHover, 1);
+}
+
+void ThemeStyle::polish(QPalette& palette) {
+    palette = theme_.palette();
+}
+
+int ThemeStyle::pixelMetric(PixelMetric metric, const QStyleOption* option,
+                            const QWidget* widget) const {
+    switch (metric) {
+        case PM_ButtonMargin:
+            return 16;
+        case PM_DefaultFrameWidth:
+            return 2;
+        default:
+            return QProxyStyle::pixelMetric(metric, option, widget);
+    }
+}
+
+void ThemeStyle::drawButtonPanel(const QStyleOption* option, QPainter* painter) const {
+    const auto* button = qstyleoption_cast<const QStyleOptionButton*>(option);
+    const bool isDefault = button && (button->features & QStyleOptionButton::DefaultButton);
+    const bool enabled = option->state & State_Enabled;
+    const bool pressed = option->state & (State_Sunken | State_On);
+    const bool hovered = option->state & State_MouseOver;
+
+    const QBrush* brush = &buttonBrush_;
+    const QPen* pen = &borderPen_;
+    if (!enabled) {
+        brush = &disabledBrush_;
+    } else if (isDefault) {
+        brush = pressed ? &defaultPressedBrush_ : hovered ? &defaultHoverBrush_ : &defaultBrush_;
+        pen = &focusPen_;
+    } else if (pressed) {
+        brush = &buttonPressedBrush_;
+    } else if (hovered) {
+        brush = &buttonHoverBrush_;
+        pen = &hoverBorderPen_;
+    }
+
+    painter->save();
+    painter->setRenderHint(QPainter::Antialiasing);
+    painter->setPen(*pen);
+    painter->setBrush(*brush);
+    painter->drawRoundedRect(QRectF(option->rect).adjusted(0.5, 0.5, -0.5, -0.5),
+                             theme_.controlRadius, theme_.controlRadius);
+    painter->restore();
+}
+
+void ThemeStyle::drawPrimitive(PrimitiveElement element, const QStyleOption* option,
+                               QPainter* painter, const QWidget* widget) const {
+    switch (element) {
+        case PE_PanelButtonCommand:
+            drawButtonPanel(option, painter);
+            return;
+
+        case PE_FrameFocusRect:
+            // Focus is shown by the control's border instead
+            return;
+
+        case PE_PanelLineEdit: {
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen((option->state & State_HasFocus) ? focusPen_ : borderPen_);
+            painter->setBrush(baseBrush_);
+            painter->drawRoundedRect(QRectF(option->rect).adjusted(0.5, 0.5, -0.5, -0.5),
+                                     theme_.controlRadius, theme_.controlRadius);
+            painter->restore();
+            return;
+        }
+
+        case PE_FrameLineEdit:
+            // Drawn together with the panel above
+            return;
+
+        case PE_FrameGroupBox: {
+            painter->save();
+            painter->setRenderHint(QPainter::Antialiasing);
+            painter->setPen(borderPen_);
+            painter->setBrush(Qt::NoBrush);
+            painter->drawRoundedRect(QRectF(option->rect).adjusted(0.5, 0.5, -0.5, -0.5), 8, 8);
+            painter->restore();
+            return;
+        }
+
+        case PE_PanelMenu:
+        case PE_FrameMenu:
+            painter->save();
+            painter->setPen(borderPen_);
+            painter->setBrush(surfaceBrush_);
+            painter->drawRect(option->rect.adjusted(0, 0, -1, -1));
+            painter->restore();
+            return;
+
+        default:
+            QProxyStyle::drawPrimitive(element, option, painter, widget);
+    }
+}
+
+}  // namespace dashboard
@@ -0,0 +1,63 @@
+// Copyright (C) 2026 Sean Moon
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+// GNU General Public License for more details.
+//
+// You should have received a copy of the GNU General Public License
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Theme.h"
+
+#include <QBrush>
+#include <QPen>
+#include <QProxyStyle>
+
+namespace dashboard {
+
+// Fusion-based style that draws the dashboard's rounded controls from cached
+// theme brushes. Replaces the application-wide style sheet, so widgets are
+// polished once by a plain QStyle instead of QStyleSheetStyle.
+class ThemeStyle : public QProxyStyle {
+    Q_OBJECT
+
+public:
+    ThemeStyle();
+
+    void setTheme(const Theme& theme);
+
+    void polish(QPalette& palette) override;
+    using QProxyStyle::polish;
+
+    void drawPrimitive(PrimitiveElement element, const QStyleOption* option, QPainter* painter,
+                       const QWidget* widget = nullptr) const override;
+    int pixelMetric(PixelMetric metric, const QStyleOption* option = nullptr,
+                    const QWidget* widget = nullptr) const override;
+
+private:
+    void drawButtonPanel(const QStyleOption* option, QPainter* painter) const;
+
+    Theme theme_;
+    QBrush buttonBrush_;
+    QBrush buttonHoverBrush_;
+    QBrush buttonPressedBrush_;
+    QBrush defaultBrush_;
+    QBrush defaultHoverBrush_;
+    QBrush defaultPressedBrush_;
+    QBrush disabledBrush_;
+    QBrush baseBrush_;
+    QBrush surfaceBrush_;
+    QPen borderPen_;
+    QPen hoverBorderPen_;
+    QPen focusPen_;
+};
+
+}  // namespace dashboard
@@ -15,68 +15,49 @@
 
 #include "TitleBar.h"
 
+#include "ChromeButton.h"
+#include "Theme.h"
+
 #include <QApplication>
 #include <QHBoxLayout>
 #include <QMouseEvent>
+#include <QPainter>
 #include <QWindow>
 
 namespace dashboard {
 
 TitleBar::TitleBar(QWidget* parent) : QWidget(parent) {
-    setAttribute(Qt::WA_StyledBackground, true);
-    setStyleSheet(
-        "TitleBar {"
-        "  background-color: #181825;"
-        "  border-bottom: 1px solid #2d2d4a;"
-        "}");
+    titleFont_ = font();
+    titleFont_.setPixelSize(13);
+    titleFont_.setWeight(QFont::DemiBold);
 
     auto* layout = new QHBoxLayout(this);
     layout->setContentsMargins(0, 0, 0, 0);
     layout->setSpacing(0);
 
-    const QString baseBtn =
-        "QPushButton {"
-        "  background: transparent;"
-        "  color: #707090;"
-        "  border: none;"
-        "  font-size: 16px;"
-        "}";
-
-    // Hamburger menu button — left side
-    menuButton_ = new QPushButton("\u2630", this);  // ☰
-    menuButton_->setStyleSheet(baseBtn + "QPushButton:hover { background: #2d2d4a; color: #c8cee8; }");
+    // Hamburger menu button — left side; the title is painted right of it
+    menuButton_ = new ChromeButton("\u2630", ChromeButton::Kind::TitleBar, this);  // ☰
     layout->addWidget(menuButton_);
-
-    titleLabel_ = new QLabel(this);
-    titleLabel_->setStyleSheet(
-        "QLabel { color: #a0a8d0; font-size: 13px; font-weight: 600;"
-        " background: transparent; padding-left: 8px; }");
-    layout->addWidget(titleLabel_);
     layout->addStretch();
 
     // Window control buttons — square, width matches height (set in resizeEvent)
-    minButton_ = new QPushButton("\u2212", this);  // −
-    maxButton_ = new QPushButton("\u25a1", this);  // □
-    closeButton_ = new QPushButton("\u00d7", this);  // ×
-
-    minButton_->setStyleSheet(baseBtn + "QPushButton:hover { background: #2d2d4a; color: #c8cee8; }");
-    maxButton_->setStyleSheet(baseBtn + "QPushButton:hover { background: #2d2d4a; color: #c8cee8; }");
-    closeButton_->setStyleSheet(
-        baseBtn + "QPushButton:hover { background: #c0392b; color: white; }");
+    minButton_ = new ChromeButton("\u2212", ChromeButton::Kind::TitleBar, this);  // −
+    maxButton_ = new ChromeButton("\u25a1", ChromeButton::Kind::TitleBar, this);  // □
+    closeButton_ = new ChromeButton("\u00d7", ChromeButton::Kind::TitleBarClose, this);  // ×
 
     layout->addWidget(minButton_);
     layout->addWidget(maxButton_);
     layout->addWidget(closeButton_);
 
-    connect(menuButton_, &QPushButton::clicked, this, [this]() {
+    connect(menuButton_, &ChromeButton::clicked, this, [this]() {
         if (menu_) {
             menu_->popup(menuButton_->mapToGlobal(QPoint(0, menuButton_->height())));
         }
     });
 
-    connect(minButton_, &QPushButton::clicked, this,
+    connect(minButton_, &ChromeButton::clicked, this,
             [this]() { window()->showMinimized(); });
-    connect(maxButton_, &QPushButton::clicked, this, [this]() {
+    connect(maxButton_, &ChromeButton::clicked, this, [this]() {
         if (maximized_) {
             window()->showNormal();
             maxButton_->setText("\u25a1");  // □
@@ -87,11 +68,12 @@ TitleBar::TitleBar(QWidget* parent) : QWidget(parent) {
             maximized_ = true;
         }
     });
-    connect(closeButton_, &QPushButton::clicked, this, [this]() { window()->close(); });
+    connect(closeButton_, &ChromeButton::clicked, this, [this]() { window()->close(); });
 }
 
 void TitleBar::setTitle(const QString& title) {
-    titleLabel_->setText(title);
+    title_ = title;
+    update();
 }
 
 void TitleBar::setMenu(QMenu* menu) {
@@ -120,6 +102,19 @@ void TitleBar::resizeEvent(QResizeEvent* event) {
     updateButtonWidths();
 }
 
+void TitleBar::paintEvent(QPaintEvent* /*event*/) {
+    const Theme& theme = Theme::current();
+    QPainter painter(this);
+    painter.fillRect(rect(), theme.titleBar);
+    painter.fillRect(0, height() - 1, width(), 1, theme.hover);
+
+    painter.setFont(titleFont_);
+    painter.setPen(theme.titleText);
+    const int left = menuButton_->width() + 8;
+    painter.drawText(QRect(left, 0, minButton_->x() - left, height()),
+                     Qt::AlignLeft | Qt::AlignVCenter, title_);
+}
+
 void TitleBar::updateButtonWidths() {
     int w = height();  // square buttons
     menuButton_->setFixedWidth(w);
@@ -15,13 +15,13 @@
 
 #pragma once
 
-#include <QLabel>
 #include <QMenu>
-#include <QPushButton>
 #include <QWidget>
 
 namespace dashboard {
 
+class ChromeButton;
+
 class TitleBar : public QWidget {
     Q_OBJECT
 
@@ -34,15 +34,17 @@ protected:
     void mousePressEvent(QMouseEvent* event) override;
     void mouseDoubleClickEvent(QMouseEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
 
 private:
     void updateButtonWidths();
 
-    QLabel* titleLabel_;
-    QPushButton* menuButton_;
-    QPushButton* minButton_;
-    QPushButton* maxButton_;
-    QPushButton* closeButton_;
+    QString title_;
+    QFont titleFont_;
+    ChromeButton* menuButton_;
+    ChromeButton* minButton_;
+    ChromeButton* maxButton_;
+    ChromeButton* closeButton_;
     QMenu* menu_ = nullptr;
     bool maximized_ = false;
 };
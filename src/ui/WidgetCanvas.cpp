@@ -15,11 +15,20 @@
 
 #include "WidgetCanvas.h"
 
+#include "ChromeButton.h"
+#include "ContentCache.h"
 #include "WidgetFrame.h"
 #include "core/ConfigStore.h"
+#include "core/IdleScheduler.h"
+#include "core/ImageCache.h"
+#include "core/PerfMonitor.h"
+#include "core/PluginLoader.h"
+#include "core/PowerProfile.h"
+#include "core/TaskExecutor.h"
 
 #include <QMouseEvent>
 #include <QPainter>
+#include <utility>
 
 namespace dashboard {
 
@@ -27,106 +36,446 @@ static constexpr int kAddButtonSize = 36;
 static constexpr int kAddButtonMargin = 16;
 static constexpr int kHoverZone = 120;
 static constexpr int kEdgePadding = 10;
+// Cards wake within this distance of the viewport and sleep beyond twice it
+static constexpr int kOffscreenMargin = 256;
+// The background is scaled while painting until the size has settled this long
+static constexpr int kBackgroundLoadDelayMs = 150;
 
 WidgetCanvas::WidgetCanvas(QWidget* parent) : QWidget(parent) {
     setAutoFillBackground(false);
     setMouseTracking(true);
 
-    addButton_ = new QPushButton("+", this);
+    addButton_ = new ChromeButton("+", ChromeButton::Kind::Accent, this);
     addButton_->setFixedSize(kAddButtonSize, kAddButtonSize);
-    addButton_->setStyleSheet(
-        "QPushButton { background-color: #3a6acc; color: white; border: none; "
-        "border-radius: 18px; font-size: 22px; font-weight: bold; }"
-        "QPushButton:hover { background-color: #4a7ae0; }"
-        "QPushButton:pressed { background-color: #2c5aa8; }");
     addButton_->hide();
     addButton_->raise();
 
-    connect(addButton_, &QPushButton::clicked, this, &WidgetCanvas::addWidgetRequested);
+    connect(addButton_, &ChromeButton::clicked, this, &WidgetCanvas::addWidgetRequested);
+
+    contentCache_ = new ContentCache(*this);
+
+    offscreenTimer_.setSingleShot(true);
+    offscreenTimer_.setInterval(0);
+    connect(&offscreenTimer_, &QTimer::timeout, this, &WidgetCanvas::updateOffscreenFrames);
+
+    bgLoadTimer_.setSingleShot(true);
+    bgLoadTimer_.setInterval(kBackgroundLoadDelayMs);
+    connect(&bgLoadTimer_, &QTimer::timeout, this, &WidgetCanvas::loadBackground);
+    if (ImageCache* cache = ImageCache::instance()) {
+        connect(cache, &ImageCache::imageReady, this,
+                [this](const QString& source, const QSize& size) {
+                    if (source == bgImagePath_ && size == backgroundDecodeSize()) {
+                        loadBackground();
+                    }
+                });
+    }
+}
+
+void WidgetCanvas::setContentFactory(ContentFactory factory) {
+    contentFactory_ = std::move(factory);
+}
+
+QWidget* WidgetCanvas::createContent(IWidget* widget, const QString& pluginName) {
+    QWidget* content;
+    {
+        PluginScope scope(pluginName, {}, PluginCall::CreateWidget);
+        content = contentFactory_ ? contentFactory_(widget, this) : widget->createWidget(this);
+    }
+    if (content && lowPower_) {
+        content->setProperty(PowerProfile::kLowPowerProperty, true);
+    }
+    if (content && IdleScheduler::instance()) {
+        content->setProperty(IdleScheduler::kSchedulerProperty,
+                             QVariant::fromValue<QObject*>(IdleScheduler::instance()));
+    }
+    if (content && TaskExecutor::instance()) {
+        TaskExecutor::instance()->setPoolProperties(content);
+    }
+    if (content && ImageCache::instance()) {
+        content->setProperty(ImageCache::kCacheProperty,
+                             QVariant::fromValue<QObject*>(ImageCache::instance()));
+    }
+    return content;
 }
 
 WidgetFrame* WidgetCanvas::addWidget(IWidget* widget, const QPoint& position) {
-    QWidget* content = widget->createWidget(this);
+    auto meta = widget->metadata();
+    // Kept by the card, PerfMonitor and HeapAccounting after the library may be unloaded
+    const QString pluginName = PluginLoader::ownedCopy(meta.name);
+    QWidget* content = createContent(widget, pluginName);
     auto* frame = new WidgetFrame(content, this);
     frame->setIWidget(widget);
+    emit pluginAttached(widget);
 
-    auto meta = widget->metadata();
-    frame->setPluginName(meta.name);
+    frame->setPluginName(pluginName);
     frame->setMinimumSize(meta.minSize);
     frame->setMaximumSize(meta.maxSize);
     frame->resize(meta.defaultSize);
     frame->move(position);
+    setupFrame(frame);
+    return frame;
+}
+
+WidgetFrame* WidgetCanvas::addPlaceholder(const QString& pluginName, const QRect& geometry) {
+    auto* frame = new WidgetFrame(nullptr, this);
+    frame->setPluginName(pluginName);
+    frame->setPlaceholder(true);
+    frame->setGeometry(geometry);
+    setupFrame(frame);
+    return frame;
+}
+
+void WidgetCanvas::setupFrame(WidgetFrame* frame) {
+    Batch batch(*this);
+    batchDirty_ = true;
+    frame->setShadowEnabled(!lowPower_);
     frame->show();
     frame->raise();
 
     frames_.append(frame);
 
     connect(frame, &WidgetFrame::deleteRequested, this, &WidgetCanvas::removeWidget);
+    connect(frame, &WidgetFrame::pressed, this, [this, frame](Qt::KeyboardModifiers modifiers) {
+        onFramePressed(frame, modifiers);
+    });
+    connect(frame, &WidgetFrame::dragged, this, [this, frame](const QPoint& delta) {
+        onFrameDragged(frame, delta);
+    });
+    connect(frame, &WidgetFrame::moved, this, [this, frame]() { onFrameMoved(frame); });
+    connect(frame, &WidgetFrame::resized, this, [this, frame]() {
+        Batch batch(*this);
+        markChanged(frame);
+    });
 
     emit widgetAdded(frame);
+    scheduleOffscreenUpdate();
+}
 
-    return frame;
+void WidgetCanvas::loadContent(WidgetFrame* frame, IWidget* widget) {
+    auto meta = widget->metadata();
+    frame->setIWidget(widget);
+    emit pluginAttached(widget);
+    frame->setMinimumSize(meta.minSize);
+    frame->setMaximumSize(meta.maxSize);
+    frame->setPlaceholder(false);
+
+    if (offscreenPolicy_ == OffscreenPolicy::Unload && !frame->geometry().intersects(keepRect())) {
+        // Stays an unloaded card; wakeFrame creates it when it comes into view
+        frame->freeze();
+        return;
+    }
+    emit contentLoading(frame);
+    // The card's copy of the name, not the plugin's: it outlives the library
+    frame->setContent(createContent(widget, frame->pluginName()));
+    emit contentLoaded(frame);
 }
 
 void WidgetCanvas::removeWidget(WidgetFrame* frame) {
+    Batch batch(*this);
     QString instanceId = frame->widgetId();
+    unloadWidget(frame);
+    batchDirty_ = true;
+    emit widgetRemoved(instanceId);
+}
+
+void WidgetCanvas::unloadWidget(WidgetFrame* frame) {
+    if (frame->iwidget()) {
+        emit pluginDetached(frame->iwidget());
+    }
+    if (frame == dragFrame_) {
+        dragFrame_ = nullptr;
+        endBatch();
+    }
     frames_.removeOne(frame);
+    pendingGeometry_.remove(frame);
+    changedFrames_.removeOne(frame);
+    if (selection_.removeOne(frame)) {
+        emit selectionChanged(int(selection_.size()));
+    }
     frame->hide();
     frame->deleteLater();
-    emit widgetRemoved(instanceId);
 }
 
-void WidgetCanvas::applyBackground(ConfigStore& config) {
-    bgMode_ = config.value("background/mode", "color").toString();
-    int opacity = config.value("background/opacity", 100).toInt();
-    bgAlpha_ = qBound(0, opacity, 100) / 100.0;
+WidgetCanvas::Batch::Batch(WidgetCanvas& canvas) : canvas_(canvas) {
+    canvas_.beginBatch();
+}
+
+WidgetCanvas::Batch::~Batch() {
+    canvas_.endBatch();
+}
+
+void WidgetCanvas::beginBatch() {
+    ++batchDepth_;
+}
+
+void WidgetCanvas::endBatch() {
+    Q_ASSERT(batchDepth_ > 0);
+    if (--batchDepth_ > 0) {
+        return;
+    }
+    applyPendingGeometry();
+    if (!batchDirty_) {
+        return;
+    }
+    batchDirty_ = false;
+    const QList<WidgetFrame*> changed = std::exchange(changedFrames_, {});
+    scheduleOffscreenUpdate();
+    emit layoutCommitted(changed);
+}
 
-    if (bgMode_ == "image") {
-        QString path = config.value("background/imagePath", "").toString();
-        bgPixmap_ = QPixmap(path);
+bool WidgetCanvas::isBatching() const {
+    return batchDepth_ > 0;
+}
+
+void WidgetCanvas::setFrameGeometry(WidgetFrame* frame, const QRect& geometry) {
+    Batch batch(*this);
+    pendingGeometry_.insert(frame, geometry);
+}
+
+void WidgetCanvas::applyPendingGeometry() {
+    // No events are processed during this pass, so Qt merges the areas the cards
+    // left and entered into the next repaint
+    for (auto it = pendingGeometry_.cbegin(); it != pendingGeometry_.cend(); ++it) {
+        if (it.key()->geometry() != it.value()) {
+            it.key()->setGeometry(it.value());
+            markChanged(it.key());
+        }
+    }
+    pendingGeometry_.clear();
+}
+
+void WidgetCanvas::markChanged(WidgetFrame* frame) {
+    if (!changedFrames_.contains(frame)) {
+        changedFrames_.append(frame);
+    }
+    batchDirty_ = true;
+}
+
+const QList<WidgetFrame*>& WidgetCanvas::selection() const {
+    return selection_;
+}
+
+void WidgetCanvas::setSelected(WidgetFrame* frame, bool selected) {
+    if (selected == selection_.contains(frame)) {
+        return;
+    }
+    if (selected) {
+        selection_.append(frame);
     } else {
-        bgPixmap_ = QPixmap();
+        selection_.removeOne(frame);
     }
+    frame->setSelected(selected);
+    emit selectionChanged(int(selection_.size()));
+}
 
-    bgColor_ = QColor(config.value("background/color", "#1a1a2a").toString());
+void WidgetCanvas::selectAll() {
+    for (auto* frame : frames_) {
+        setSelected(frame, true);
+    }
+}
+
+void WidgetCanvas::clearSelection() {
+    for (auto* frame : QList<WidgetFrame*>(selection_)) {
+        setSelected(frame, false);
+    }
+}
+
+void WidgetCanvas::removeSelected() {
+    Batch batch(*this);
+    for (auto* frame : QList<WidgetFrame*>(selection_)) {
+        removeWidget(frame);
+    }
+}
+
+void WidgetCanvas::onFramePressed(WidgetFrame* frame, Qt::KeyboardModifiers modifiers) {
+    if (modifiers & Qt::ControlModifier) {
+        setSelected(frame, !frame->isSelected());
+    } else if (!frame->isSelected()) {
+        clearSelection();
+    }
+}
+
+void WidgetCanvas::onFrameDragged(WidgetFrame* frame, const QPoint& delta) {
+    if (!frame->isSelected()) {
+        return;
+    }
+    // The whole drag is one batch, committed as one layout change on the drop
+    if (!dragFrame_) {
+        dragFrame_ = frame;
+        beginBatch();
+    }
+    // The dragged card moved itself; the rest of the selection follows in one pass
+    for (auto* other : selection_) {
+        if (other != frame) {
+            setFrameGeometry(other, other->geometry().translated(delta));
+        }
+    }
+    applyPendingGeometry();
+}
+
+void WidgetCanvas::onFrameMoved(WidgetFrame* frame) {
+    Batch batch(*this);
+    markChanged(frame);
+    if (frame->isSelected()) {
+        for (auto* other : selection_) {
+            markChanged(other);
+        }
+    }
+    if (frame == dragFrame_) {
+        dragFrame_ = nullptr;
+        endBatch();
+    }
+}
+
+void WidgetCanvas::setVisibleRect(const QRect& rect) {
+    visibleRect_ = rect;
+    positionAddButton();
+    scheduleOffscreenUpdate();
+}
+
+QRect WidgetCanvas::visibleRect() const {
+    return visibleRect_.isEmpty() ? rect() : visibleRect_.intersected(rect());
+}
+
+void WidgetCanvas::setOffscreenPolicy(OffscreenPolicy policy) {
+    offscreenPolicy_ = policy;
+    scheduleOffscreenUpdate();
+}
+
+void WidgetCanvas::scheduleOffscreenUpdate() {
+    if (!offscreenTimer_.isActive()) {
+        offscreenTimer_.start();
+    }
+}
+
+void WidgetCanvas::updateOffscreenFrames() {
+    const QRect view = visibleRect();
+    const QRect wakeRect = view.adjusted(-kOffscreenMargin, -kOffscreenMargin,
+                                         kOffscreenMargin, kOffscreenMargin);
+    const QRect keep = keepRect();
+    for (auto* frame : frames_) {
+        if (frame->isPlaceholder()) {
+            continue;  // created by the restore pipeline, not here
+        }
+        if (offscreenPolicy_ == OffscreenPolicy::Live || frame->geometry().intersects(wakeRect)) {
+            wakeFrame(frame);
+        } else if (!frame->geometry().intersects(keep)) {
+            sleepFrame(frame);
+        }
+    }
+}
+
+QRect WidgetCanvas::keepRect() const {
+    return visibleRect().adjusted(-2 * kOffscreenMargin, -2 * kOffscreenMargin,
+                                  2 * kOffscreenMargin, 2 * kOffscreenMargin);
+}
+
+void WidgetCanvas::sleepFrame(WidgetFrame* frame) {
+    frame->freeze();
+    if (offscreenPolicy_ == OffscreenPolicy::Unload && frame->contentWidget()) {
+        emit contentUnloading(frame);
+        frame->setContent(nullptr);
+    }
+}
+
+void WidgetCanvas::wakeFrame(WidgetFrame* frame) {
+    if (!frame->contentWidget() && frame->iwidget()) {
+        emit contentLoading(frame);
+        frame->setContent(createContent(frame->iwidget(), frame->pluginName()));
+        frame->thaw();
+        emit contentLoaded(frame);
+    } else {
+        frame->thaw();
+    }
+}
+
+void WidgetCanvas::setLowPower(bool lowPower) {
+    if (lowPower == lowPower_) {
+        return;
+    }
+    lowPower_ = lowPower;
+    for (auto* frame : frames_) {
+        frame->setShadowEnabled(!lowPower_);
+        if (QWidget* content = frame->contentWidget()) {
+            content->setProperty(PowerProfile::kLowPowerProperty, lowPower_);
+        }
+    }
+    update();
+}
+
+void WidgetCanvas::applyBackground(const ConfigStore& store) {
+    bgMode_ = store.get(config::backgroundMode);
+    int opacity = store.get(config::backgroundOpacity);
+    bgAlpha_ = qBound(0, opacity, 100) / 100.0;
+
+    // Decoding the image is the expensive part; only redo it when the file changes
+    QString path = bgMode_ == "image" ? store.get(config::backgroundImagePath) : QString();
+    if (path != bgImagePath_) {
+        // The previous image stays up until the new one is decoded
+        bgImagePath_ = path;
+        loadBackground();
+    }
+
+    bgColor_ = QColor(store.get(config::backgroundColor));
 
     update();
 }
 
 void WidgetCanvas::paintEvent(QPaintEvent* /*event*/) {
     QPainter painter(this);
+    paintBackground(painter, rect());
+}
 
-    if (bgMode_ == "image" && !bgPixmap_.isNull()) {
-        QPixmap scaled = bgPixmap_.scaled(size(), Qt::KeepAspectRatioByExpanding,
-                                          Qt::SmoothTransformation);
+void WidgetCanvas::paintBackground(QPainter& painter, const QRect& target) const {
+    painter.save();
+    if (bgMode_ == "image" && !bgImage_.isNull()) {
+        // Drawn 1:1 when target is the canvas; the overview and a resize in progress scale it
+        const QSize scaled = bgImage_.deviceIndependentSize().toSize().scaled(
+            target.size(), Qt::KeepAspectRatioByExpanding);
         // Center the scaled image
-        int x = (width() - scaled.width()) / 2;
-        int y = (height() - scaled.height()) / 2;
+        int x = target.x() + (target.width() - scaled.width()) / 2;
+        int y = target.y() + (target.height() - scaled.height()) / 2;
 
+        painter.setClipRect(target);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform, !lowPower_);
         if (bgAlpha_ < 1.0) {
-            painter.fillRect(rect(), Qt::white);
+            painter.fillRect(target, Qt::white);
             painter.setOpacity(bgAlpha_);
         }
-        painter.drawPixmap(x, y, scaled);
+        painter.drawPixmap(QRect(QPoint(x, y), scaled), bgImage_);
     } else {
         QColor color = bgColor_;
         color.setAlphaF(bgAlpha_);
-        painter.fillRect(rect(), color);
+        painter.fillRect(target, color);
     }
+    painter.restore();
 }
 
 QPoint WidgetCanvas::centerPosition(const QSize& widgetSize) const {
-    return QPoint((width() - widgetSize.width()) / 2,
-                  (height() - widgetSize.height()) / 2);
+    const QRect view = visibleRect();
+    return QPoint(view.x() + (view.width() - widgetSize.width()) / 2,
+                  view.y() + (view.height() - widgetSize.height()) / 2);
 }
 
 const QList<WidgetFrame*>& WidgetCanvas::frames() const {
     return frames_;
 }
 
+ContentCache& WidgetCanvas::contentCache() const {
+    return *contentCache_;
+}
+
+void WidgetCanvas::mousePressEvent(QMouseEvent* event) {
+    if (event->button() == Qt::LeftButton && !(event->modifiers() & Qt::ControlModifier)) {
+        clearSelection();
+    }
+    QWidget::mousePressEvent(event);
+}
+
 void WidgetCanvas::mouseMoveEvent(QMouseEvent* event) {
+    const QRect view = visibleRect();
     QPoint pos = event->pos();
-    bool inZone = pos.x() >= width() - kHoverZone && pos.y() <= kHoverZone;
+    bool inZone = pos.x() >= view.right() - kHoverZone && pos.y() <= view.top() + kHoverZone;
     if (inZone) {
         addButton_->show();
         addButton_->raise();
@@ -147,17 +496,61 @@ void WidgetCanvas::resizeEvent(QResizeEvent* event) {
     QWidget::resizeEvent(event);
     positionAddButton();
     clampFramePositions();
+    scheduleOffscreenUpdate();
+    if (bgImage_.isNull()) {
+        loadBackground();
+    } else {
+        bgLoadTimer_.start();
+    }
+}
+
+QSize WidgetCanvas::backgroundDecodeSize() const {
+    const QSize view = visibleRect().size();
+    return size().scaled(view, Qt::KeepAspectRatioByExpanding).boundedTo(size());
+}
+
+void WidgetCanvas::loadBackground() {
+    if (bgImagePath_.isEmpty()) {
+        bgImage_ = QPixmap();
+        return;
+    }
+    if (size().isEmpty()) {
+        return;
+    }
+    const qreal dpr = devicePixelRatioF();
+    const QSize decodeSize = backgroundDecodeSize();
+    if (ImageCache* cache = ImageCache::instance()) {
+        // On a miss, imageReady brings us back here
+        const QPixmap image =
+            cache->pixmap(bgImagePath_, decodeSize, dpr, Qt::KeepAspectRatioByExpanding);
+        if (!image.isNull()) {
+            bgImage_ = image;
+            update();
+        }
+        return;
+    }
+    // Helper processes and benchmarks have no cache: decode here, once per size
+    bgImage_ = QPixmap::fromImage(
+        ImageCache::decode(bgImagePath_, decodeSize * dpr, Qt::KeepAspectRatioByExpanding));
+    bgImage_.setDevicePixelRatio(dpr);
+    update();
 }
 
 void WidgetCanvas::positionAddButton() {
-    addButton_->move(width() - kAddButtonSize - kAddButtonMargin, kAddButtonMargin);
+    const QRect view = visibleRect();
+    addButton_->move(view.right() + 1 - kAddButtonSize - kAddButtonMargin,
+                     view.top() + kAddButtonMargin);
 }
 
 void WidgetCanvas::clampFramePositions() {
+    Batch batch(*this);
     for (auto* frame : frames_) {
-        int x = qBound(kEdgePadding, frame->x(), width() - frame->width() - kEdgePadding);
-        int y = qBound(kEdgePadding, frame->y(), height() - frame->height() - kEdgePadding);
-        frame->move(x, y);
+        const QRect geometry = pendingGeometry_.value(frame, frame->geometry());
+        int x = qBound(kEdgePadding, geometry.x(), width() - geometry.width() - kEdgePadding);
+        int y = qBound(kEdgePadding, geometry.y(), height() - geometry.height() - kEdgePadding);
+        if (geometry.topLeft() != QPoint(x, y)) {
+            setFrameGeometry(frame, geometry.translated(x - geometry.x(), y - geometry.y()));
+        }
     }
 }
 
@@ -18,38 +18,115 @@
 #include <dashboard/IWidget.h>
 
 #include <QColor>
+#include <QHash>
 #include <QList>
 #include <QPixmap>
-#include <QPushButton>
 #include <QString>
+#include <QTimer>
 #include <QWidget>
+#include <functional>
+
+class QPainter;
 
 namespace dashboard {
 
+class ChromeButton;
 class ConfigStore;
+class ContentCache;
 class WidgetFrame;
 
 class WidgetCanvas : public QWidget {
     Q_OBJECT
 
 public:
+    // Creates the content widget placed inside each WidgetFrame.
+    using ContentFactory = std::function<QWidget*(IWidget* widget, QWidget* parent)>;
+
+    // What happens to cards outside the visible rect (plus a margin).
+    enum class OffscreenPolicy { Live, Snapshot, Unload };
+
+    // Scoped beginBatch()/endBatch()
+    class Batch {
+    public:
+        explicit Batch(WidgetCanvas& canvas);
+        ~Batch();
+        Batch(const Batch&) = delete;
+        Batch& operator=(const Batch&) = delete;
+
+    private:
+        WidgetCanvas& canvas_;
+    };
+
     explicit WidgetCanvas(QWidget* parent = nullptr);
 
+    void setContentFactory(ContentFactory factory);
+
     WidgetFrame* addWidget(IWidget* widget, const QPoint& position = {});
+    // Adds an empty card at a saved position; loadContent() fills it in later.
+    WidgetFrame* addPlaceholder(const QString& pluginName, const QRect& geometry);
+    // Creates the content of a placeholder. Under OffscreenPolicy::Unload a card
+    // outside the view only records its plugin and is created once scrolled to.
+    void loadContent(WidgetFrame* frame, IWidget* widget);
     void removeWidget(WidgetFrame* frame);
-
-    void applyBackground(ConfigStore& config);
+    // Destroys the frame without emitting widgetRemoved; its saved state is kept.
+    void unloadWidget(WidgetFrame* frame);
+
+    // Geometry changes between beginBatch() and endBatch() are queued and applied
+    // in one pass when the outermost batch ends, so the cards are repainted once.
+    // layoutCommitted() is then emitted once for every move, resize and removal
+    // in the batch. Each edit made outside a batch is a batch of its own.
+    void beginBatch();
+    void endBatch();
+    bool isBatching() const;
+    void setFrameGeometry(WidgetFrame* frame, const QRect& geometry);
+
+    // Ctrl+click toggles a card's selection and a plain click elsewhere clears it.
+    // Dragging a selected card moves the whole selection, in one batch that lasts
+    // until the drop.
+    const QList<WidgetFrame*>& selection() const;
+    void setSelected(WidgetFrame* frame, bool selected);
+    void selectAll();
+    void clearSelection();
+    void removeSelected();
+
+    // The part of the canvas the user can see when it is larger than its viewport.
+    void setVisibleRect(const QRect& rect);
+    QRect visibleRect() const;
+    void setOffscreenPolicy(OffscreenPolicy policy);
+    // Low-power rendering: no card shadows, fast background scaling, and content
+    // widgets get PowerProfile::kLowPowerProperty set.
+    void setLowPower(bool lowPower);
+
+    void applyBackground(const ConfigStore& store);
+    // Paints the configured background scaled into target (also used by the overview)
+    void paintBackground(QPainter& painter, const QRect& target) const;
 
     QPoint centerPosition(const QSize& widgetSize) const;
     const QList<WidgetFrame*>& frames() const;
     void clampFramePositions();
 
+    // Rests visible cards with unchanging content on a snapshot
+    ContentCache& contentCache() const;
+
 signals:
     void addWidgetRequested();
     void widgetAdded(WidgetFrame* frame);
     void widgetRemoved(const QString& instanceId);
+    // Emitted before content is destroyed under OffscreenPolicy::Unload, and
+    // around creating content for an unloaded card or a placeholder
+    void contentUnloading(WidgetFrame* frame);
+    void contentLoading(WidgetFrame* frame);
+    void contentLoaded(WidgetFrame* frame);
+    // A card took or dropped its plugin instance (see WidgetManager::retain)
+    void pluginAttached(IWidget* widget);
+    void pluginDetached(IWidget* widget);
+    // End of a batch that moved, resized or removed cards; changed lists the
+    // cards still on the canvas whose geometry changed
+    void layoutCommitted(const QList<WidgetFrame*>& changed);
+    void selectionChanged(int count);
 
 protected:
+    void mousePressEvent(QMouseEvent* event) override;
     void mouseMoveEvent(QMouseEvent* event) override;
     void leaveEvent(QEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
@@ -57,14 +134,49 @@ protected:
 
 private:
     void positionAddButton();
-
-    QPushButton* addButton_;
+    QWidget* createContent(IWidget* widget, const QString& pluginName);
+    void scheduleOffscreenUpdate();
+    void updateOffscreenFrames();
+    void sleepFrame(WidgetFrame* frame);
+    void wakeFrame(WidgetFrame* frame);
+    void setupFrame(WidgetFrame* frame);
+    QRect keepRect() const;
+    void markChanged(WidgetFrame* frame);
+    // Applies queued geometry now; the batch stays open
+    void applyPendingGeometry();
+    void onFramePressed(WidgetFrame* frame, Qt::KeyboardModifiers modifiers);
+    void onFrameDragged(WidgetFrame* frame, const QPoint& delta);
+    void onFrameMoved(WidgetFrame* frame);
+    // Decodes the background image, through ImageCache when there is one
+    void loadBackground();
+    // The canvas size scaled down to cover the viewport; paintBackground scales
+    // the image up to the canvas, which may be several viewports large
+    QSize backgroundDecodeSize() const;
+
+    ChromeButton* addButton_;
+    ContentCache* contentCache_;
     QList<WidgetFrame*> frames_;
+    ContentFactory contentFactory_;
+
+    QRect visibleRect_;
+    OffscreenPolicy offscreenPolicy_ = OffscreenPolicy::Snapshot;  // canvas/offscreen default
+    QTimer offscreenTimer_;
+    bool lowPower_ = false;
+
+    // Batch state
+    int batchDepth_ = 0;
+    bool batchDirty_ = false;
+    QHash<WidgetFrame*, QRect> pendingGeometry_;
+    QList<WidgetFrame*> changedFrames_;
+    QList<WidgetFrame*> selection_;
+    WidgetFrame* dragFrame_ = nullptr;  // selected card being dragged; holds a batch
 
     // Background state
     QString bgMode_;
     QColor bgColor_{0x2d, 0x2d, 0x2d};
-    QPixmap bgPixmap_;
+    QString bgImagePath_;
+    QPixmap bgImage_;  // at the size it was last loaded for
+    QTimer bgLoadTimer_;
     double bgAlpha_ = 1.0;
 };
 
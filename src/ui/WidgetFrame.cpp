@@ -15,11 +15,16 @@
 
 #include "WidgetFrame.h"
 
+#include "ChromeButton.h"
+#include "Theme.h"
+
 #include <QGraphicsDropShadowEffect>
 #include <QMessageBox>
 #include <QMouseEvent>
+#include <QPainter>
 #include <QVBoxLayout>
 #include <dashboard/IWidget.h>
+#include <utility>
 
 namespace dashboard {
 
@@ -28,38 +33,25 @@ WidgetFrame::WidgetFrame(QWidget* content, QWidget* parent)
     setFrameShape(QFrame::NoFrame);
     setFrameShadow(QFrame::Plain);
     setLineWidth(0);
-    setAttribute(Qt::WA_StyledBackground, true);
     setObjectName("widgetFrame");
-    setStyleSheet(
-        "#widgetFrame {"
-        "  background-color: #26263a;"
-        "  border: 1px solid #3e3e60;"
-        "  border-radius: 10px;"
-        "}");
 
-    auto* shadow = new QGraphicsDropShadowEffect(this);
-    shadow->setBlurRadius(18);
-    shadow->setOffset(0, 4);
-    shadow->setColor(QColor(0, 0, 0, 140));
-    setGraphicsEffect(shadow);
+    setShadowEnabled(true);
 
     setMouseTracking(true);
 
     auto* layout = new QVBoxLayout(this);
     layout->setContentsMargins(8, 8, 8, 8);
-    layout->addWidget(content_);
+    if (content_) {
+        layout->addWidget(content_);
+    }
 
     // Delete button — overlaid on top, not part of the layout
-    deleteButton_ = new QPushButton("\u2715", this);
+    deleteButton_ = new ChromeButton("\u2715", ChromeButton::Kind::Card, this);
     deleteButton_->setFixedSize(22, 22);
-    deleteButton_->setStyleSheet(
-        "QPushButton { background-color: #36364e; color: #a0a8c8; border: none; "
-        "border-radius: 11px; font-size: 12px; font-weight: bold; }"
-        "QPushButton:hover { background-color: #d04040; color: white; }");
     deleteButton_->hide();
     deleteButton_->raise();
 
-    connect(deleteButton_, &QPushButton::clicked, this, [this]() {
+    connect(deleteButton_, &ChromeButton::clicked, this, [this]() {
         auto answer = QMessageBox::question(
             this, "Delete Widget",
             QString("Remove \"%1\" from the dashboard?")
@@ -75,6 +67,87 @@ QWidget* WidgetFrame::contentWidget() const {
     return content_;
 }
 
+void WidgetFrame::setContent(QWidget* content) {
+    pause_.resume();
+    delete content_;
+    content_ = content;
+    if (content_) {
+        layout()->addWidget(content_);
+        content_->setVisible(!frozen_);
+        if (frozen_) {
+            pause_.pause(content_);
+        }
+    }
+}
+
+void WidgetFrame::freeze() {
+    if (frozen_) {
+        return;
+    }
+    if (content_) {
+        snapshot_ = content_->grab();
+        content_->hide();
+        pause_.pause(content_);
+    }
+    frozen_ = true;
+    update();
+}
+
+void WidgetFrame::thaw() {
+    if (!frozen_) {
+        return;
+    }
+    frozen_ = false;
+    pause_.resume();
+    if (content_) {
+        content_->show();
+    }
+    snapshot_ = QPixmap();
+}
+
+bool WidgetFrame::isFrozen() const {
+    return frozen_;
+}
+
+const QPixmap& WidgetFrame::snapshot() const {
+    return snapshot_;
+}
+
+void WidgetFrame::setPlaceholder(bool placeholder) {
+    placeholder_ = placeholder;
+    update();
+}
+
+bool WidgetFrame::isPlaceholder() const {
+    return placeholder_;
+}
+
+void WidgetFrame::setShadowEnabled(bool enabled) {
+    if (enabled == (graphicsEffect() != nullptr)) {
+        return;
+    }
+    if (!enabled) {
+        setGraphicsEffect(nullptr);
+        return;
+    }
+    auto* shadow = new QGraphicsDropShadowEffect(this);
+    shadow->setBlurRadius(18);
+    shadow->setOffset(0, 4);
+    shadow->setColor(QColor(0, 0, 0, 140));
+    setGraphicsEffect(shadow);
+}
+
+void WidgetFrame::setSelected(bool selected) {
+    if (selected != selected_) {
+        selected_ = selected;
+        update();
+    }
+}
+
+bool WidgetFrame::isSelected() const {
+    return selected_;
+}
+
 void WidgetFrame::setWidgetId(const QString& id) {
     widgetId_ = id;
 }
@@ -99,6 +172,34 @@ IWidget* WidgetFrame::iwidget() const {
     return iwidget_;
 }
 
+static constexpr int kMaxWarnings = 5;
+
+void WidgetFrame::addWarning(const QString& message) {
+    if (!warningBadge_) {
+        warningBadge_ = new ChromeButton("\u26a0", ChromeButton::Kind::Warning, this);  // ⚠
+        warningBadge_->setFixedSize(22, 22);
+        warningBadge_->move(6, 6);
+        warningBadge_->show();
+    }
+    warnings_.prepend(message);
+    if (warnings_.size() > kMaxWarnings) {
+        warnings_.removeLast();
+    }
+    warningBadge_->setToolTip(warnings_.join('\n'));
+    warningBadge_->raise();
+}
+
+void WidgetFrame::removeWarning(const QString& message) {
+    if (!warningBadge_ || warnings_.removeAll(message) == 0) {
+        return;
+    }
+    if (warnings_.isEmpty()) {
+        delete std::exchange(warningBadge_, nullptr);
+    } else {
+        warningBadge_->setToolTip(warnings_.join('\n'));
+    }
+}
+
 static constexpr int kResizeZone = 8;
 
 WidgetFrame::ResizeEdge WidgetFrame::hitTest(const QPoint& pos) const {
@@ -176,6 +277,11 @@ void WidgetFrame::applyResize(const QPoint& parentPos) {
 
 void WidgetFrame::mousePressEvent(QMouseEvent* event) {
     if (event->button() == Qt::LeftButton) {
+        emit pressed(event->modifiers());
+        if (event->modifiers() & Qt::ControlModifier) {
+            QFrame::mousePressEvent(event);
+            return;
+        }
         ResizeEdge edge = hitTest(event->pos());
         if (edge != ResizeEdge::None) {
             resizing_ = true;
@@ -198,6 +304,7 @@ void WidgetFrame::mouseMoveEvent(QMouseEvent* event) {
     } else if (dragging_) {
         QPoint delta = event->pos() - dragStart_;
         move(pos() + delta);
+        emit dragged(delta);
     } else {
         applyCursorForEdge(hitTest(event->pos()));
     }
@@ -229,6 +336,34 @@ void WidgetFrame::leaveEvent(QEvent* /*event*/) {
 void WidgetFrame::resizeEvent(QResizeEvent* event) {
     QFrame::resizeEvent(event);
     positionDeleteButton();
+    updateCardPath();
+}
+
+void WidgetFrame::updateCardPath() {
+    cardPathRadius_ = Theme::current().cardRadius;
+    cardPath_ = QPainterPath();
+    cardPath_.addRoundedRect(QRectF(rect()).adjusted(0.5, 0.5, -0.5, -0.5), cardPathRadius_,
+                             cardPathRadius_);
+}
+
+void WidgetFrame::paintEvent(QPaintEvent* /*event*/) {
+    const Theme& theme = Theme::current();
+    // Theme::apply may have changed the radius since the last resize
+    if (theme.cardRadius != cardPathRadius_) {
+        updateCardPath();
+    }
+    QPainter painter(this);
+    painter.setRenderHint(QPainter::Antialiasing);
+    painter.setPen(selected_ ? QPen(theme.accent, 2) : QPen(theme.cardBorder));
+    painter.setBrush(theme.surface);
+    painter.drawPath(cardPath_);
+
+    if (frozen_ && !snapshot_.isNull()) {
+        painter.drawPixmap(layout()->contentsRect(), snapshot_);
+    } else if (placeholder_) {
+        painter.setPen(theme.mutedText);
+        painter.drawText(rect(), Qt::AlignCenter, pluginName_);
+    }
 }
 
 void WidgetFrame::positionDeleteButton() {
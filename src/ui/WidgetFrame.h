@@ -15,13 +15,17 @@
 
 #pragma once
 
+#include "core/ContentPause.h"
+
 #include <QFrame>
+#include <QPainterPath>
+#include <QPixmap>
 #include <QPoint>
-#include <QPushButton>
 #include <QRect>
 
 namespace dashboard {
 
+class ChromeButton;
 class IWidget;
 
 class WidgetFrame : public QFrame {
@@ -37,6 +41,8 @@ public:
     explicit WidgetFrame(QWidget* content, QWidget* parent = nullptr);
 
     QWidget* contentWidget() const;
+    // Replaces and deletes the current content; nullptr leaves an empty card.
+    void setContent(QWidget* content);
     void setWidgetId(const QString& id);
     QString widgetId() const;
     void setPluginName(const QString& name);
@@ -44,7 +50,34 @@ public:
     void setIWidget(IWidget* widget);
     IWidget* iwidget() const;
 
+    // Shows a warning badge on the card; the tooltip lists the most recent warnings.
+    void addWarning(const QString& message);
+    // Drops every copy of message; the badge goes away with the last warning.
+    void removeWarning(const QString& message);
+
+    // A frozen card hides its content and paints the last snapshot instead.
+    // The content's timers are held until thaw (see ContentPause).
+    void freeze();
+    void thaw();
+    bool isFrozen() const;
+    const QPixmap& snapshot() const;
+
+    // A placeholder card stands in for a widget that has not been created yet.
+    void setPlaceholder(bool placeholder);
+    bool isPlaceholder() const;
+
+    // The blurred drop shadow re-renders the whole card offscreen on every update.
+    void setShadowEnabled(bool enabled);
+
+    // Drawn with an accent outline; WidgetCanvas owns the selection.
+    void setSelected(bool selected);
+    bool isSelected() const;
+
 signals:
+    // Left button pressed on the card's chrome; Ctrl+press starts no drag or resize
+    void pressed(Qt::KeyboardModifiers modifiers);
+    // During a drag, by how much the card just moved
+    void dragged(const QPoint& delta);
     void moved(const QPoint& newPos);
     void resized(const QSize& newSize);
     void deleteRequested(WidgetFrame* frame);
@@ -56,15 +89,26 @@ protected:
     void enterEvent(QEnterEvent* event) override;
     void leaveEvent(QEvent* event) override;
     void resizeEvent(QResizeEvent* event) override;
+    void paintEvent(QPaintEvent* event) override;
 
 private:
     void positionDeleteButton();
+    void updateCardPath();
     ResizeEdge hitTest(const QPoint& localPos) const;
     void applyCursorForEdge(ResizeEdge edge);
     void applyResize(const QPoint& parentPos);
 
     QWidget* content_;
-    QPushButton* deleteButton_;
+    ChromeButton* deleteButton_;
+    ChromeButton* warningBadge_ = nullptr;
+    QPainterPath cardPath_;  // rebuilt on resize or theme change, reused for every paint
+    int cardPathRadius_ = -1;
+    QStringList warnings_;
+    QPixmap snapshot_;
+    ContentPause pause_;  // content timers, held while frozen
+    bool frozen_ = false;
+    bool placeholder_ = false;
+    bool selected_ = false;
     IWidget* iwidget_ = nullptr;
     QString widgetId_;
     QString pluginName_;